@@ -0,0 +1,112 @@
+#!/usr/bin/env python3
+#
+# Generates chksum/crc_tab.h - lookup tables for table and slice-by-4/8 CRC backends.
+#
+# Table 0 is ordinary byte lookup table, table k gives crc of byte followed by k zero bytes.
+#
+# usage: _tools/crc_tab_gen.py > chksum/crc_tab.h
+#
+
+HEADER = """/*!
+ * \\file crc_tab.h
+ *
+ * \\author Marcin O'BenY Benka <obeny@obeny.net>
+ * \\date 17.10.2026
+ * \\version 1
+ *
+ * \\brief Cyclic redundancy check lookup tables, included only by crc.c
+ * \\details
+ * Table 0 is ordinary byte lookup table, tables 1..7 are used by slice-by-4/8 backends. Only tables
+ * of backends selected in crc.c (xxx_TABLES definitions) are compiled.
+ * \\note
+ * File is generated with _tools/crc_tab_gen.py, do not edit.
+ */
+
+#ifndef _CRC_TAB_H
+#define _CRC_TAB_H
+"""
+
+FOOTER = """#endif // _CRC_TAB_H
+
+// END"""
+
+# name: (type, table variable, tables count definition, hex digits, description)
+CRCS = [
+	('crc8', ('UINT8', 'aui8_crc8_table', 'CRC8_TABLES', 2, 'CRC-8 (0x07)')),
+	('crc16_ccitt', ('UINT16', 'aui16_crc16_ccitt_table', 'CRC16_CCITT_TABLES', 4, 'CRC-16/CCITT (0x1021)')),
+	('crc16_modbus', ('UINT16', 'aui16_crc16_modbus_table', 'CRC16_MODBUS_TABLES', 4, 'CRC-16/MODBUS (reflected 0x8005)')),
+	('crc32', ('UINT32', 'aui32_crc32_table', 'CRC32_TABLES', 8, 'CRC-32 (reflected 0x04C11DB7)')),
+]
+
+
+def byte_table(name):
+	table = []
+	for b in range(256):
+		if name == 'crc8':
+			c = b
+			for _ in range(8):
+				c = ((c << 1) ^ 0x07) & 0xFF if c & 0x80 else (c << 1) & 0xFF
+		elif name == 'crc16_ccitt':
+			c = b << 8
+			for _ in range(8):
+				c = ((c << 1) ^ 0x1021) & 0xFFFF if c & 0x8000 else (c << 1) & 0xFFFF
+		elif name == 'crc16_modbus':
+			c = b
+			for _ in range(8):
+				c = (c >> 1) ^ 0xA001 if c & 1 else c >> 1
+		else:
+			c = b
+			for _ in range(8):
+				c = (c >> 1) ^ 0xEDB88320 if c & 1 else c >> 1
+		table.append(c)
+	return table
+
+
+def slice_tables(name):
+	tables = [byte_table(name)]
+	for k in range(1, 8):
+		prev = tables[k - 1]
+		table = []
+		for b in range(256):
+			# one more zero byte after crc of previous table
+			c = prev[b]
+			if name == 'crc8':
+				c = tables[0][c]
+			elif name == 'crc16_ccitt':
+				c = ((c << 8) & 0xFFFF) ^ tables[0][c >> 8]
+			else:
+				c = (c >> 8) ^ tables[0][c & 0xFF]
+			table.append(c)
+		tables.append(table)
+	return tables
+
+
+def main():
+	out = [HEADER]
+	for name, (ctype, var, count, digits, desc) in CRCS:
+		tables = slice_tables(name)
+		per_line = 16 if digits == 2 else 8
+		out.append('#ifdef %s' % count)
+		out.append('// %s, table k gives crc of byte followed by k zero bytes' % desc)
+		out.append('static const %s %s[%s][256] = {' % (ctype, var, count))
+		for k in range(8):
+			if k == 1:
+				out.append('#if (%s > 1)' % count)
+			elif k == 4:
+				out.append('#if (%s > 4)' % count)
+			out.append('\t{')
+			for i in range(0, 256, per_line):
+				line = ', '.join('0x%0*X' % (digits, v) for v in tables[k][i:i + per_line])
+				out.append('\t\t' + line + (',' if i + per_line < 256 else ''))
+			out.append('\t},')
+		out.append('#endif // %s > 4' % count)
+		out.append('#endif // %s > 1' % count)
+		out.append('};')
+		out.append('#endif // %s' % count)
+		out.append('')
+	out.append(FOOTER)
+	print('\n'.join(out))
+
+
+if __name__ == '__main__':
+	main()
@@ -0,0 +1,121 @@
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+/*!
+ * \file adc_dma.c
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief Analog-to-Digital converter scan mode acquisition using DMA - implementation.
+ * \note
+ * For detailed description see header file.
+ */
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#include "config.h"
+#include "ehal/adc/adc_dma.h"
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+// check channel count
+#ifndef ADC_CHANNELS_COUNT
+	#error "ADC: ADC_CHANNELS_COUNT is not set!"
+#endif
+
+// check block size
+#ifndef ADC_DMA_BLOCK_SCANS
+	#error "ADC: ADC_DMA_BLOCK_SCANS is not set!"
+#endif
+
+#if ((ADC_DMA_BLOCK_SCANS < 1) || (ADC_DMA_BLOCK_SCANS & (ADC_DMA_BLOCK_SCANS - 1)) || (ADC_DMA_BLOCK_SCANS > 256))
+	#error "ADC: ADC_DMA_BLOCK_SCANS is not a power of 2 from 1 to 256!"
+#endif
+
+// buffer length is passed to DMA as 16-bit count
+#if (2 * ADC_DMA_BLOCK_SIZE > 0xFFFF)
+	#error "ADC: ADC_DMA_BLOCK_SCANS * ADC_CHANNELS_COUNT is too big for DMA transfer!"
+#endif
+
+// ping-pong blocks filled by DMA
+static UINT16 aui16_adc_dma_buff[2 * ADC_DMA_BLOCK_SIZE];
+static UINT8 aui8_adc_dma_mapping[ADC_CHANNELS_COUNT];
+static volatile UINT16 aui16_adc_dma_results[ADC_CHANNELS_COUNT];
+static volatile UINT32 ui32_adc_dma_blocks = 0;
+static adc_dma_block_cb_t adc_dma_block_cb = NULL;
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+// --------------------------------------------------------------------------
+UINT32 adcDmaBlocks(void)
+{
+	return (ui32_adc_dma_blocks);
+}
+
+// --------------------------------------------------------------------------
+VOID adcDmaIsrBlock(const BOOL b_second)
+{
+	const UINT16 *pui16_block = aui16_adc_dma_buff + ((b_second)?(ADC_DMA_BLOCK_SIZE):(0));
+	const UINT16 *pui16_scan = pui16_block;
+	UINT32 aui32_sums[ADC_CHANNELS_COUNT] = {0};
+
+	// samples are interleaved, single pass over the block
+	for (UINT16 i = 0; i < ADC_DMA_BLOCK_SCANS; ++i, pui16_scan += ADC_CHANNELS_COUNT)
+	{
+		for (UINT8 ch = 0; ch < ADC_CHANNELS_COUNT; ++ch)
+			aui32_sums[ch] += pui16_scan[ch];
+	}
+
+	// division by power of two constant is reduced to shift
+	for (UINT8 ch = 0; ch < ADC_CHANNELS_COUNT; ++ch)
+		aui16_adc_dma_results[ch] = aui32_sums[ch] / ADC_DMA_BLOCK_SCANS;
+	++ui32_adc_dma_blocks;
+
+	if (adc_dma_block_cb)
+		adc_dma_block_cb(pui16_block);
+}
+
+// --------------------------------------------------------------------------
+UINT16 adcDmaResult(const UINT8 ui8_channel)
+{
+	return (aui16_adc_dma_results[ui8_channel]);
+}
+
+// --------------------------------------------------------------------------
+VOID adcDmaSetMapping(const UINT8 ui8_hw_channel, const UINT8 ui8_index)
+{
+	aui8_adc_dma_mapping[ui8_index] = ui8_hw_channel;
+}
+
+// --------------------------------------------------------------------------
+VOID adcDmaStart(const adc_dma_block_cb_t cb)
+{
+	adc_dma_block_cb = cb;
+	ui32_adc_dma_blocks = 0;
+
+	march_adcDmaStart(aui16_adc_dma_buff, 2 * ADC_DMA_BLOCK_SIZE, aui8_adc_dma_mapping, ADC_CHANNELS_COUNT);
+}
+
+// --------------------------------------------------------------------------
+VOID adcDmaStop(void)
+{
+	march_adcDmaStop();
+}
+
+// END
@@ -0,0 +1,126 @@
+/*!
+ * \file adc_dma.h
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief Analog-to-Digital converter scan mode acquisition using DMA - definitions
+ * \details
+ * Hardware scans all mapped channels and DMA stores results into circular buffer split into two blocks
+ * (ping-pong). Half and full transfer complete interrupts deliver whole block, so cpu does not take part
+ * in acquisition of single samples. Each block holds ADC_DMA_BLOCK_SCANS scans of ADC_CHANNELS_COUNT
+ * interleaved samples. On block completion per channel average of the block is computed and block is handed
+ * to user callback, while DMA fills the other one.
+ *
+ * This library needs to work following definitions to be set in config.h:
+ * - ADC_CHANNELS_COUNT - number of channels in scan sequence
+ * - ADC_DMA_BLOCK_SCANS - scans in single block (power of two, up to 256)
+ *
+ * \note
+ * Logical channels have to be mapped with particular HW channel with adcDmaSetMapping before adcDmaStart.
+ * Callback is executed in interrupt context and has to finish before the next block completes.
+ * \warning
+ * Implementation for particular architecture is contained in related version of library in adc_dma_march.c,
+ * which implements march_adcDmaStart()/march_adcDmaStop() and calls adcDmaIsrBlock() from DMA half and
+ * full transfer complete interrupts.
+ */
+
+#ifndef _ADC_DMA_H
+#define _ADC_DMA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#include "ehal/global.h"
+#include "config.h"
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+/*!
+ * \def ADC_DMA_BLOCK_SIZE
+ * \brief number of samples in single block
+ */
+#define ADC_DMA_BLOCK_SIZE (ADC_DMA_BLOCK_SCANS * ADC_CHANNELS_COUNT)
+
+/*!
+ * \typedef adc_dma_block_cb_t
+ * \brief callback receiving completed block of ADC_DMA_BLOCK_SCANS interleaved scans
+ */
+typedef VOID (*adc_dma_block_cb_t)(const UINT16 *pui16_block);
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+/*!
+ * \fn adcDmaBlocks
+ * \brief gets number of blocks completed since start
+ * \return blocks count
+ */
+UINT32 adcDmaBlocks(void);
+/*!
+ * \fn adcDmaResult(const UINT8 ui8_channel)
+ * \brief read average of selected logical channel in latest block
+ * \param ui8_channel logical channel number
+ * \return averaged ADC value
+ */
+UINT16 adcDmaResult(const UINT8 ui8_channel);
+/*!
+ * \fn adcDmaSetMapping(const UINT8 ui8_hw_channel, const UINT8 ui8_index)
+ * \brief map hardware channel to selected position in scan sequence
+ * \param ui8_hw_channel hardrware channel (see ADC_CH in adc_common_mach.h)
+ * \param ui8_index logical channel number
+ */
+VOID adcDmaSetMapping(const UINT8 ui8_hw_channel, const UINT8 ui8_index);
+/*!
+ * \fn adcDmaStart(const adc_dma_block_cb_t cb)
+ * \brief start continuous scan conversion with DMA transfer
+ * \param cb callback executed for each completed block, may be NULL if only averages are used
+ */
+VOID adcDmaStart(const adc_dma_block_cb_t cb);
+/*!
+ * \fn adcDmaStop
+ * \brief stop scan conversion and DMA transfer
+ */
+VOID adcDmaStop(void);
+
+/*!
+ * \fn adcDmaIsrBlock(const BOOL b_second)
+ * \brief compute averages of completed block and deliver it, to be called from architecture DMA half/full
+ * transfer complete interrupt handler
+ * \param b_second false for half transfer (first block), true for full transfer (second block)
+ */
+VOID adcDmaIsrBlock(const BOOL b_second);
+
+/*!
+ * \fn march_adcDmaStart(UINT16 *pui16_buff, const UINT16 ui16_length, const UINT8 *pui8_mapping, const UINT8 ui8_channels)
+ * \brief configure scan sequence and start circular DMA transfer, implemented in adc_dma_march.c
+ * \param pui16_buff destination buffer consisting of two blocks
+ * \param ui16_length buffer length in samples, up to 0xFFFF
+ * \param pui8_mapping hardware channels in scan order
+ * \param ui8_channels number of channels in scan sequence
+ */
+VOID march_adcDmaStart(UINT16 *pui16_buff, const UINT16 ui16_length, const UINT8 *pui8_mapping, const UINT8 ui8_channels);
+/*!
+ * \fn march_adcDmaStop
+ * \brief stop scan conversion and DMA transfer, implemented in adc_dma_march.c
+ */
+VOID march_adcDmaStop(void);
+
+#ifdef __cplusplus
+}
+#endif // extern "C"
+
+#endif // _ADC_DMA_H
+
+// END
@@ -25,6 +25,7 @@
 
 #include "config.h"
 #include "ehal/adc/adc_isr.h"
+#include "ehal/sync_timer/sync_timer.h"
 
 
 /***************************************************************************
@@ -45,6 +46,50 @@
 	#error "ADC: ADC_CHANNELS_COUNT is not set!"
 #endif
 
+#if defined(ADC_OVERSAMPLING) && !defined(ADC_RESOLUTION_BITS)
+	#error "ADC: ADC_RESOLUTION_BITS is not set!"
+#endif
+
+#if defined(ADC_FILTER_MEDIAN) && (ADC_FILTER_MEDIAN != 3) && (ADC_FILTER_MEDIAN != 5)
+	#error "ADC: ADC_FILTER_MEDIAN has to be 3 or 5"
+#endif
+
+#if defined(ADC_FILTER_IIR_SHIFT) && ((ADC_FILTER_IIR_SHIFT < 1) || (ADC_FILTER_IIR_SHIFT > 15))
+	#error "ADC: ADC_FILTER_IIR_SHIFT out of range (1..15)"
+#endif
+
+#if defined(ADC_FILTER_MINMAX) && ((ADC_FILTER_MINMAX & (ADC_FILTER_MINMAX - 1)) || (ADC_FILTER_MINMAX > 128))
+	#error "ADC: ADC_FILTER_MINMAX has to be a power of two (max = 128)"
+#endif
+
+#ifdef ADC_WINDOW
+#if ((ADC_WINDOW & (ADC_WINDOW - 1)) || (ADC_WINDOW > 128))
+	#error "ADC: ADC_WINDOW has to be a power of two (max = 128)"
+#endif
+
+#if (!defined(SYNC_TIMER_US) && !defined(SYNC_TIMER_JIFFIES))
+	#error "ADC: ADC_WINDOW requires SYNC_TIMER_JIFFIES or SYNC_TIMER_US"
+#endif
+#endif // ADC_WINDOW
+
+#ifdef ADC_CAPTURE
+#if (!RING_SIZE_VALID(ADC_CAPTURE) || (ADC_CAPTURE < 8))
+	#error "ADC: ADC_CAPTURE has to be a power of two (min = 8, max = RING_SIZE_MAX bytes)"
+#endif
+
+#if (!defined(SYNC_TIMER_US) && !defined(SYNC_TIMER_JIFFIES))
+	#error "ADC: ADC_CAPTURE requires SYNC_TIMER_JIFFIES or SYNC_TIMER_US"
+#endif
+
+#if (ADC_CHANNELS_COUNT > 32)
+	#error "ADC: ADC_CAPTURE supports up to 32 channels"
+#endif
+#endif // ADC_CAPTURE
+
+#if (ADC_SAMPLES_COUNT > 256)
+	#error "ADC: ADC_SAMPLES_COUNT exceeds 256!"
+#endif
+
 #if (ADC_SAMPLES_COUNT == 1)
 	#define ADC_SAMPLES_SHIFT 0
 #elif (ADC_SAMPLES_COUNT == 2)
@@ -53,15 +98,119 @@
 	#define ADC_SAMPLES_SHIFT 2
 #elif (ADC_SAMPLES_COUNT == 8)
 	#define ADC_SAMPLES_SHIFT 3
+#elif (ADC_SAMPLES_COUNT == 16)
+	#define ADC_SAMPLES_SHIFT 4
+#elif (ADC_SAMPLES_COUNT == 32)
+	#define ADC_SAMPLES_SHIFT 5
+#elif (ADC_SAMPLES_COUNT == 64)
+	#define ADC_SAMPLES_SHIFT 6
+#elif (ADC_SAMPLES_COUNT == 128)
+	#define ADC_SAMPLES_SHIFT 7
 #else
-	#define ADC_SAMPLES_SHIFT 0xFF
+	#define ADC_SAMPLES_SHIFT 8
 #endif
 
 volatile UINT16 ui16_adc_measurements[ADC_CHANNELS_COUNT][ADC_SAMPLES_COUNT];
+volatile UINT32 ui32_adc_sums[ADC_CHANNELS_COUNT];
 volatile UINT8 ui8_adc_channel_mapping[ADC_CHANNELS_COUNT];
 volatile UINT8 ui8_adc_current_channel = 0;
 volatile UINT8 ui8_adc_sample = 0;
 
+#ifdef ADC_OVERSAMPLING
+adc_oversample_st a_adc_oversample[ADC_CHANNELS_COUNT];
+#endif // ADC_OVERSAMPLING
+
+#ifdef ADC_FILTERS
+#ifdef ADC_FILTER_MINMAX
+#define ADC_FILTER_MINMAX_MASK (ADC_FILTER_MINMAX - 1)
+
+// monotonic queue of window samples, front is min (max) of the window
+// indices are free running and masked on access (as in ring.h), so full window is not taken for empty queue
+typedef struct
+{
+	UINT16 aui16_value[ADC_FILTER_MINMAX];
+	UINT8 aui8_seq[ADC_FILTER_MINMAX];
+	UINT8 ui8_front;
+	UINT8 ui8_back;
+} adc_minmax_queue_st;
+#endif // ADC_FILTER_MINMAX
+
+// filter chain state
+typedef struct
+{
+	BOOL b_init;
+#ifdef ADC_FILTER_MEDIAN
+	UINT16 aui16_median[ADC_FILTER_MEDIAN];
+	UINT8 ui8_median_pos;
+#endif // ADC_FILTER_MEDIAN
+#ifdef ADC_FILTER_IIR_SHIFT
+	UINT32 ui32_iir;
+#endif // ADC_FILTER_IIR_SHIFT
+#ifdef ADC_FILTER_MINMAX
+	UINT8 ui8_seq;
+	adc_minmax_queue_st min;
+	adc_minmax_queue_st max;
+	volatile UINT16 ui16_min;
+	volatile UINT16 ui16_max;
+#endif // ADC_FILTER_MINMAX
+	volatile UINT16 ui16_output;
+} adc_filter_st;
+
+static adc_filter_st a_adc_filters[ADC_CHANNELS_COUNT];
+
+// static functions
+#ifdef ADC_FILTER_MEDIAN
+static UINT16 adc_filterMedian(const UINT16 *pui16_window);
+#endif // ADC_FILTER_MEDIAN
+#ifdef ADC_FILTER_MINMAX
+static UINT16 adc_filterMinMaxPush(adc_minmax_queue_st *queue, const UINT8 ui8_seq, const UINT16 ui16_value, const BOOL b_max);
+#endif // ADC_FILTER_MINMAX
+#endif // ADC_FILTERS
+
+#ifdef ADC_WINDOW
+#define ADC_WINDOW_MASK (ADC_WINDOW - 1)
+
+// window comparator, release levels include hysteresis
+typedef struct
+{
+	UINT16 ui16_low;
+	UINT16 ui16_high;
+	UINT16 ui16_low_release;
+	UINT16 ui16_high_release;
+	volatile UINT8 ui8_state;
+} adc_window_st;
+
+static adc_window_st a_adc_windows[ADC_CHANNELS_COUNT];
+static adc_window_event_st a_adc_window_events[ADC_WINDOW];
+// event queue indices as in ring.h: interrupt owns head, reader owns tail
+static volatile UINT8 ui8_adc_window_head = 0;
+static volatile UINT8 ui8_adc_window_tail = 0;
+static volatile UINT32 ui32_adc_window_overruns = 0;
+#endif // ADC_WINDOW
+
+#ifdef ADC_CAPTURE
+// capture trigger with previous sample of its channel
+typedef struct
+{
+	adc_trigger_st cfg;
+	UINT16 ui16_prev;
+	BOOL b_prev;
+} adc_capture_trigger_st;
+
+static BYTE ac_adc_capture_buff[ADC_CAPTURE];
+static ring_st adc_capture_ring;
+static volatile e_adc_capture_t adc_capture_state = ADC_CAPTURE_IDLE;
+static UINT32 ui32_adc_capture_channels;
+static UINT32 ui32_adc_capture_left;
+static volatile UINT32 ui32_adc_capture_overruns;
+static adc_capture_trigger_st adc_capture_start;
+static adc_capture_trigger_st adc_capture_stop;
+
+// static functions
+static VOID adc_captureSetTrigger(adc_capture_trigger_st *trig, const adc_trigger_st *cfg);
+static BOOL adc_captureTriggered(adc_capture_trigger_st *trig, const UINT8 ui8_channel, const UINT16 ui16_value);
+#endif // ADC_CAPTURE
+
 
 /***************************************************************************
  *	FUNCTIONS
@@ -70,24 +219,453 @@ volatile UINT8 ui8_adc_sample = 0;
 // --------------------------------------------------------------------------
 UINT16 adcIsrResult(const UINT8 channel)
 {
-	UINT16 ui16_result = 0;
+	UINT32 ui32_sum;
 
-	for (UINT8 i = 0; i < ADC_SAMPLES_COUNT; ++i)
-		ui16_result += ui16_adc_measurements[channel][i];
+	// sum may be updated by interrupt in the middle of multi-byte read on 8-bit cpus
+	do
+	{
+		ui32_sum = ui32_adc_sums[channel];
+	}
+	while (ui32_sum != ui32_adc_sums[channel]);
 
-#if (ADC_SAMPLES_SHIFT == 0xFF)
-	ui16_result /= ADC_SAMPLES_COUNT;
-#else
-	ui16_result = (ui16_result >> ADC_SAMPLES_SHIFT);
-#endif // (ADC_SAMPLES_SHIFT == 0xFF)
+	return (ui32_sum >> ADC_SAMPLES_SHIFT);
+}
+
+#ifdef ADC_OVERSAMPLING
+// --------------------------------------------------------------------------
+UINT16 adcIsrOversampledResult(const UINT8 ui8_channel, UINT8 *pui8_bits)
+{
+	UINT16 ui16_result;
+
+	if (pui8_bits)
+		*pui8_bits = ADC_RESOLUTION_BITS + a_adc_oversample[ui8_channel].ui8_bits;
+
+	// result may be updated by interrupt in the middle of multi-byte read on 8-bit cpus
+	do
+	{
+		ui16_result = a_adc_oversample[ui8_channel].ui16_result;
+	}
+	while (ui16_result != a_adc_oversample[ui8_channel].ui16_result);
 
 	return (ui16_result);
 }
 
+// --------------------------------------------------------------------------
+BOOL adcIsrSetOversampling(const UINT8 ui8_channel, const UINT8 ui8_extra_bits)
+{
+	adc_oversample_st *os = &a_adc_oversample[ui8_channel];
+
+	if ((ADC_RESOLUTION_BITS + ui8_extra_bits) > 16)
+		return (false);
+
+	// disable channel while its state is changed
+	os->ui8_bits = 0;
+	os->ui32_acc = 0;
+	os->ui16_result = 0;
+	os->ui32_left = (UINT32)1 << (2 * ui8_extra_bits);
+	os->ui8_bits = ui8_extra_bits;
+
+	return (true);
+}
+#endif // ADC_OVERSAMPLING
+
+#ifdef ADC_FILTERS
+// --------------------------------------------------------------------------
+UINT16 adcIsrFiltered(const UINT8 ui8_channel)
+{
+	UINT16 ui16_result;
+
+	// result may be updated by interrupt in the middle of multi-byte read on 8-bit cpus
+	do
+	{
+		ui16_result = a_adc_filters[ui8_channel].ui16_output;
+	}
+	while (ui16_result != a_adc_filters[ui8_channel].ui16_output);
+
+	return (ui16_result);
+}
+
+// --------------------------------------------------------------------------
+VOID adcIsrFilterReset(const UINT8 ui8_channel)
+{
+	a_adc_filters[ui8_channel].b_init = false;
+}
+
+// --------------------------------------------------------------------------
+VOID adcIsrFilterSample(const UINT8 ui8_channel, const UINT16 ui16_sample)
+{
+	adc_filter_st *filter = &a_adc_filters[ui8_channel];
+	UINT16 ui16_value = ui16_sample;
+
+	// first sample fills whole filter state
+	if (!filter->b_init)
+	{
+#ifdef ADC_FILTER_MEDIAN
+		for (UINT8 i = 0; i < ADC_FILTER_MEDIAN; ++i)
+			filter->aui16_median[i] = ui16_value;
+		filter->ui8_median_pos = 0;
+#endif // ADC_FILTER_MEDIAN
+#ifdef ADC_FILTER_IIR_SHIFT
+		filter->ui32_iir = (UINT32)ui16_value << ADC_FILTER_IIR_SHIFT;
+#endif // ADC_FILTER_IIR_SHIFT
+#ifdef ADC_FILTER_MINMAX
+		filter->min.ui8_front = filter->min.ui8_back = 0;
+		filter->max.ui8_front = filter->max.ui8_back = 0;
+#endif // ADC_FILTER_MINMAX
+		filter->b_init = true;
+	}
+
+#ifdef ADC_FILTER_MEDIAN
+	filter->aui16_median[filter->ui8_median_pos] = ui16_value;
+	if (++filter->ui8_median_pos == ADC_FILTER_MEDIAN)
+		filter->ui8_median_pos = 0;
+	ui16_value = adc_filterMedian(filter->aui16_median);
+#endif // ADC_FILTER_MEDIAN
+
+#ifdef ADC_FILTER_MINMAX
+	++filter->ui8_seq;
+	filter->ui16_min = adc_filterMinMaxPush(&filter->min, filter->ui8_seq, ui16_value, false);
+	filter->ui16_max = adc_filterMinMaxPush(&filter->max, filter->ui8_seq, ui16_value, true);
+#endif // ADC_FILTER_MINMAX
+
+#ifdef ADC_FILTER_IIR_SHIFT
+	// accumulator holds output scaled by 2^shift, no precision is lost between samples
+	filter->ui32_iir -= filter->ui32_iir >> ADC_FILTER_IIR_SHIFT;
+	filter->ui32_iir += ui16_value;
+	ui16_value = filter->ui32_iir >> ADC_FILTER_IIR_SHIFT;
+#endif // ADC_FILTER_IIR_SHIFT
+
+	filter->ui16_output = ui16_value;
+}
+
+#ifdef ADC_FILTER_MINMAX
+// --------------------------------------------------------------------------
+VOID adcIsrMinMax(const UINT8 ui8_channel, UINT16 *pui16_min, UINT16 *pui16_max)
+{
+	adc_filter_st *filter = &a_adc_filters[ui8_channel];
+
+	do
+	{
+		*pui16_min = filter->ui16_min;
+		*pui16_max = filter->ui16_max;
+	}
+	while ((*pui16_min != filter->ui16_min) || (*pui16_max != filter->ui16_max));
+}
+#endif // ADC_FILTER_MINMAX
+#endif // ADC_FILTERS
+
+#ifdef ADC_WINDOW
+// --------------------------------------------------------------------------
+VOID adcIsrWindowDisable(const UINT8 ui8_channel)
+{
+	a_adc_windows[ui8_channel].ui8_state = ADC_WINDOW_OFF;
+}
+
+// --------------------------------------------------------------------------
+BOOL adcIsrWindowEvent(adc_window_event_st *event)
+{
+	UINT8 ui8_tail = ui8_adc_window_tail;
+
+	if (ui8_adc_window_head == ui8_tail)
+		return (false);
+
+	RING_BARRIER();
+	*event = a_adc_window_events[ui8_tail & ADC_WINDOW_MASK];
+	RING_BARRIER();
+	ui8_adc_window_tail = ui8_tail + 1;
+
+	return (true);
+}
+
+// --------------------------------------------------------------------------
+UINT32 adcIsrWindowOverruns(void)
+{
+	return (ui32_adc_window_overruns);
+}
+
+// --------------------------------------------------------------------------
+VOID adcIsrWindowSample(const UINT8 ui8_channel, const UINT16 ui16_value)
+{
+	adc_window_st *window = &a_adc_windows[ui8_channel];
+	adc_window_event_st event;
+	UINT8 ui8_state = window->ui8_state;
+	UINT8 ui8_head;
+
+	if (ADC_WINDOW_OFF == ui8_state)
+		return;
+
+	if (ui16_value > window->ui16_high)
+		ui8_state = ADC_WINDOW_ABOVE;
+	else if (ui16_value < window->ui16_low)
+		ui8_state = ADC_WINDOW_BELOW;
+	else if (((ADC_WINDOW_ABOVE == ui8_state) && (ui16_value < window->ui16_high_release))
+		|| ((ADC_WINDOW_BELOW == ui8_state) && (ui16_value > window->ui16_low_release)))
+		ui8_state = ADC_WINDOW_INSIDE;
+
+	if (ui8_state == window->ui8_state)
+		return;
+	window->ui8_state = ui8_state;
+
+#ifdef SYNC_TIMER_US
+	event.ui32_timestamp = syncTimerNowUs();
+#else
+	event.ui32_timestamp = jiffies;
+#endif // SYNC_TIMER_US
+	event.ui16_value = ui16_value;
+	event.ui8_channel = ui8_channel;
+	event.ui8_state = ui8_state;
+
+	// single producer, slot is filled before it is published to consumer
+	ui8_head = ui8_adc_window_head;
+	if ((UINT8)(ui8_head - ui8_adc_window_tail) >= ADC_WINDOW)
+		++ui32_adc_window_overruns;
+	else
+	{
+		a_adc_window_events[ui8_head & ADC_WINDOW_MASK] = event;
+		RING_BARRIER();
+		ui8_adc_window_head = ui8_head + 1;
+	}
+
+#ifdef ADC_WINDOW_HANDLER
+	adcIsrWindowHandler(&event);
+#endif // ADC_WINDOW_HANDLER
+}
+
+// --------------------------------------------------------------------------
+VOID adcIsrWindowSet(const UINT8 ui8_channel, const UINT16 ui16_low, const UINT16 ui16_high, const UINT16 ui16_hysteresis)
+{
+	adc_window_st *window = &a_adc_windows[ui8_channel];
+
+	// disable channel while its thresholds are changed
+	window->ui8_state = ADC_WINDOW_OFF;
+	window->ui16_low = ui16_low;
+	window->ui16_high = ui16_high;
+	window->ui16_low_release = (ui16_hysteresis < (0xFFFF - ui16_low))?(ui16_low + ui16_hysteresis):(0xFFFF);
+	window->ui16_high_release = (ui16_hysteresis < ui16_high)?(ui16_high - ui16_hysteresis):(0);
+	window->ui8_state = ADC_WINDOW_INSIDE;
+}
+
+// --------------------------------------------------------------------------
+e_adc_window_t adcIsrWindowState(const UINT8 ui8_channel)
+{
+	return ((e_adc_window_t)a_adc_windows[ui8_channel].ui8_state);
+}
+#endif // ADC_WINDOW
+
+#ifdef ADC_CAPTURE
+// --------------------------------------------------------------------------
+VOID adcIsrCaptureConsume(const UINT16 ui16_length)
+{
+	ringConsume(&adc_capture_ring, ui16_length);
+}
+
+// --------------------------------------------------------------------------
+UINT32 adcIsrCaptureOverruns(void)
+{
+	return (ui32_adc_capture_overruns);
+}
+
+// --------------------------------------------------------------------------
+UINT16 adcIsrCapturePeek(const BYTE **ppc_data)
+{
+	return (ringPeek(&adc_capture_ring, (BYTE**)ppc_data));
+}
+
+// --------------------------------------------------------------------------
+UINT16 adcIsrCaptureRead(adc_capture_sample_st *samples, const UINT16 ui16_count)
+{
+	UINT16 ui16_available = ringUsed(&adc_capture_ring) / sizeof(adc_capture_sample_st);
+
+	// records are always written whole, so whole ones are read
+	if (ui16_available > ui16_count)
+		ui16_available = ui16_count;
+
+	return (ringRead(&adc_capture_ring, (BYTE*)samples, ui16_available * sizeof(adc_capture_sample_st)) / sizeof(adc_capture_sample_st));
+}
+
+// --------------------------------------------------------------------------
+VOID adcIsrCaptureSample(const UINT8 ui8_channel, const UINT16 ui16_value)
+{
+	adc_capture_sample_st sample;
+
+	if ((ADC_CAPTURE_IDLE == adc_capture_state) || (ADC_CAPTURE_DONE == adc_capture_state))
+		return;
+
+	// both triggers follow their channels all the time, so slope is known when armed
+	if (adc_captureTriggered(&adc_capture_start, ui8_channel, ui16_value) && (ADC_CAPTURE_ARMED == adc_capture_state))
+		adc_capture_state = ADC_CAPTURE_RUNNING;
+	if (adc_captureTriggered(&adc_capture_stop, ui8_channel, ui16_value) && (ADC_CAPTURE_RUNNING == adc_capture_state))
+	{
+		adc_capture_state = ADC_CAPTURE_DONE;
+		return;
+	}
+
+	if ((ADC_CAPTURE_RUNNING != adc_capture_state) || !(ui32_adc_capture_channels & (1UL << ui8_channel)))
+		return;
+
+#ifdef SYNC_TIMER_US
+	sample.ui32_timestamp = syncTimerNowUs();
+#else
+	sample.ui32_timestamp = jiffies;
+#endif // SYNC_TIMER_US
+	sample.ui16_value = ui16_value;
+	sample.ui8_channel = ui8_channel;
+	sample.ui8_reserved = 0;
+
+	if (ringFree(&adc_capture_ring) < sizeof(sample))
+		++ui32_adc_capture_overruns;
+	else
+		ringWrite(&adc_capture_ring, (const BYTE*)&sample, sizeof(sample));
+
+	if (ui32_adc_capture_left && !--ui32_adc_capture_left)
+		adc_capture_state = ADC_CAPTURE_DONE;
+}
+
+// --------------------------------------------------------------------------
+VOID adcIsrCaptureStart(const UINT32 ui32_channels, const adc_trigger_st *start, const adc_trigger_st *stop, const UINT32 ui32_samples)
+{
+	// stop producer before its state is changed
+	adc_capture_state = ADC_CAPTURE_IDLE;
+
+	ringInit(&adc_capture_ring, ac_adc_capture_buff, ADC_CAPTURE);
+	ui32_adc_capture_channels = ui32_channels;
+	ui32_adc_capture_left = ui32_samples;
+	ui32_adc_capture_overruns = 0;
+	adc_captureSetTrigger(&adc_capture_start, start);
+	adc_captureSetTrigger(&adc_capture_stop, stop);
+
+	adc_capture_state = (ADC_TRIGGER_NONE == adc_capture_start.cfg.type)?(ADC_CAPTURE_RUNNING):(ADC_CAPTURE_ARMED);
+}
+
+// --------------------------------------------------------------------------
+e_adc_capture_t adcIsrCaptureState(void)
+{
+	return (adc_capture_state);
+}
+
+// --------------------------------------------------------------------------
+VOID adcIsrCaptureStop(void)
+{
+	adc_capture_state = ADC_CAPTURE_IDLE;
+}
+#endif // ADC_CAPTURE
+
 // --------------------------------------------------------------------------
 void adcIsrSetMapping(const UINT8 hw_channel, const UINT8 index)
 {
 	ui8_adc_channel_mapping[index] = hw_channel;
 }
 
+// static functions
+#ifdef ADC_FILTER_MEDIAN
+// --------------------------------------------------------------------------
+static UINT16 adc_filterMedian(const UINT16 *pui16_window)
+{
+	UINT16 a[ADC_FILTER_MEDIAN];
+	UINT16 t;
+
+#define ADC_FILTER_CSWAP(i, j) if (a[i] > a[j]) { t = a[i]; a[i] = a[j]; a[j] = t; }
+	for (UINT8 i = 0; i < ADC_FILTER_MEDIAN; ++i)
+		a[i] = pui16_window[i];
+
+	// sorting network, order of samples in window does not matter
+#if (ADC_FILTER_MEDIAN == 3)
+	ADC_FILTER_CSWAP(0, 1);
+	ADC_FILTER_CSWAP(1, 2);
+	ADC_FILTER_CSWAP(0, 1);
+
+	return (a[1]);
+#else
+	ADC_FILTER_CSWAP(0, 1);
+	ADC_FILTER_CSWAP(3, 4);
+	ADC_FILTER_CSWAP(2, 4);
+	ADC_FILTER_CSWAP(2, 3);
+	ADC_FILTER_CSWAP(0, 3);
+	ADC_FILTER_CSWAP(0, 2);
+	ADC_FILTER_CSWAP(1, 4);
+	ADC_FILTER_CSWAP(1, 3);
+	ADC_FILTER_CSWAP(1, 2);
+
+	return (a[2]);
+#endif // ADC_FILTER_MEDIAN
+#undef ADC_FILTER_CSWAP
+}
+#endif // ADC_FILTER_MEDIAN
+
+#ifdef ADC_FILTER_MINMAX
+// --------------------------------------------------------------------------
+static UINT16 adc_filterMinMaxPush(adc_minmax_queue_st *queue, const UINT8 ui8_seq, const UINT16 ui16_value, const BOOL b_max)
+{
+	UINT8 ui8_last;
+
+	// drop samples which can no longer become min (max) of the window
+	while (queue->ui8_front != queue->ui8_back)
+	{
+		ui8_last = queue->ui8_back - 1;
+		if ((b_max)?(queue->aui16_value[ui8_last & ADC_FILTER_MINMAX_MASK] > ui16_value):(queue->aui16_value[ui8_last & ADC_FILTER_MINMAX_MASK] < ui16_value))
+			break;
+		queue->ui8_back = ui8_last;
+	}
+
+	// drop front sample leaving the window, at most one per push
+	if ((queue->ui8_front != queue->ui8_back) && ((UINT8)(ui8_seq - queue->aui8_seq[queue->ui8_front & ADC_FILTER_MINMAX_MASK]) >= ADC_FILTER_MINMAX))
+		++queue->ui8_front;
+
+	queue->aui16_value[queue->ui8_back & ADC_FILTER_MINMAX_MASK] = ui16_value;
+	queue->aui8_seq[queue->ui8_back & ADC_FILTER_MINMAX_MASK] = ui8_seq;
+	++queue->ui8_back;
+
+	return (queue->aui16_value[queue->ui8_front & ADC_FILTER_MINMAX_MASK]);
+}
+#endif // ADC_FILTER_MINMAX
+
+#ifdef ADC_CAPTURE
+// --------------------------------------------------------------------------
+static VOID adc_captureSetTrigger(adc_capture_trigger_st *trig, const adc_trigger_st *cfg)
+{
+	if (cfg)
+		trig->cfg = *cfg;
+	else
+		trig->cfg.type = ADC_TRIGGER_NONE;
+	trig->b_prev = false;
+}
+
+// --------------------------------------------------------------------------
+static BOOL adc_captureTriggered(adc_capture_trigger_st *trig, const UINT8 ui8_channel, const UINT16 ui16_value)
+{
+	BOOL b = false;
+	UINT16 ui16_prev = trig->ui16_prev;
+
+	if ((ADC_TRIGGER_NONE == trig->cfg.type) || (ui8_channel != trig->cfg.ui8_channel))
+		return (false);
+
+	trig->ui16_prev = ui16_value;
+	if (!trig->b_prev)
+	{
+		trig->b_prev = true;
+		return (false);
+	}
+
+	switch (trig->cfg.type)
+	{
+		case ADC_TRIGGER_RISING:
+			b = (ui16_prev < trig->cfg.ui16_level) && (ui16_value >= trig->cfg.ui16_level);
+			break;
+
+		case ADC_TRIGGER_FALLING:
+			b = (ui16_prev > trig->cfg.ui16_level) && (ui16_value <= trig->cfg.ui16_level);
+			break;
+
+		case ADC_TRIGGER_SLOPE:
+			b = (((ui16_value > ui16_prev)?(ui16_value - ui16_prev):(ui16_prev - ui16_value)) >= trig->cfg.ui16_level);
+			break;
+
+		default:
+			break;
+	}
+
+	return (b);
+}
+#endif // ADC_CAPTURE
+
 // END
@@ -14,9 +14,46 @@
  * This library needs to work following definitions to be set in config.h:
  * - ADC_SAMPLES_COUNT - samples used to calculate current ADC value
  * - ADC_CHANNELS_COUNT - number of channels for which values have to be collected
+ * Optional:
+ * - ADC_OVERSAMPLING - enable per channel oversampling and decimation, requires:
+ *   - ADC_RESOLUTION_BITS - native resolution of ADC
+ * - ADC_FILTER_MEDIAN - enable median filter stage of given length (3 or 5)
+ * - ADC_FILTER_IIR_SHIFT - enable single-pole IIR stage y += (x - y) / 2^ADC_FILTER_IIR_SHIFT (1..15)
+ * - ADC_FILTER_MINMAX - enable rolling min/max of given window length (power of two, up to 128)
+ * - ADC_WINDOW - enable window comparators, defines size of event queue (power of two, up to 128), requires
+ *   SYNC_TIMER_JIFFIES (timestamps in jiffies) or SYNC_TIMER_US (timestamps in us)
+ * - ADC_WINDOW_HANDLER - if defined user handler is executed in interrupt for each window event
+ * - ADC_CAPTURE - enable capture of raw timestamped samples, defines size of capture ring in bytes (power
+ *   of two), requires SYNC_TIMER_JIFFIES (timestamps in jiffies) or SYNC_TIMER_US (timestamps in us)
  * 
  * \note
  * Logical channels have to be mapped with particular HW channel with adcIsrSetMapping.
+ * \note
+ * Sum of samples is kept per channel and updated with each conversion, so reading averaged value costs
+ * single load and shift regardless of ADC_SAMPLES_COUNT (power of two, up to 256). Architecture conversion
+ * complete handler has to store samples with adcIsrStoreSample(), never directly into samples array.
+ * \warning
+ * Older adc_isr_march.c handlers wrote ui16_adc_measurements directly. They still build, but
+ * adcIsrResult() returns 0 for such handlers, so each of them has to be migrated to adcIsrStoreSample().
+ * \note
+ * In oversampling mode 4^n samples of channel are accumulated and sum is shifted right by n, which gives
+ * n additional effective bits (input noise of at least 1 LSB is required). Only additions and shift are
+ * performed in interrupt, result is available with adcIsrOversampledResult().
+ * \note
+ * Filter chain is run for each channel in interrupt: median (sorting network, removes spikes), then IIR
+ * (fixed point accumulator), result is read with adcIsrFiltered(). Rolling min/max follows median output
+ * and is updated with monotonic queues (amortized O(1)), read with adcIsrMinMax().
+ * \note
+ * Window comparator checks each raw sample of channel against low/high threshold in interrupt. Leaving
+ * the window posts timestamped event to queue (and calls ADC_WINDOW_HANDLER), returning requires value to
+ * be inside by hysteresis, so noise around threshold does not flood the queue. Protection reacts within
+ * single conversion instead of main loop iteration, no polling of adcIsrResult() is needed.
+ * \note
+ * In capture mode samples of selected channels are pushed from interrupt to lock-free single producer/single
+ * consumer ring as adc_capture_sample_st records, consumer drains them in batches (adcIsrCaptureRead() or
+ * raw bytes with adcIsrCapturePeek()/adcIsrCaptureConsume() for zero-copy streaming). Samples not fitting
+ * into ring are counted as overruns. Capture is started and optionally stopped by level or slope trigger
+ * on any channel.
  * \warning
  * Depending on MCU architecture additional configuration definitions may be required.
  * Implementation for particular architecture is contained in related version of library in adc_isr_march.c.
@@ -32,6 +69,10 @@
 #include "ehal/global.h"
 #include "config.h"
 
+#if defined(ADC_CAPTURE) || defined(ADC_WINDOW)
+#include "ehal/ring/ring.h"
+#endif // ADC_CAPTURE || ADC_WINDOW
+
 
 /***************************************************************************
  *	DEFINITIONS
@@ -43,6 +84,142 @@
  */
 #define ADC_SAMPLES_COUNT_MASK (ADC_SAMPLES_COUNT - 1)
 
+// samples and their running sums, used internally
+extern volatile UINT16 ui16_adc_measurements[ADC_CHANNELS_COUNT][ADC_SAMPLES_COUNT];
+extern volatile UINT32 ui32_adc_sums[ADC_CHANNELS_COUNT];
+
+#ifdef ADC_OVERSAMPLING
+/*!
+ * \struct adc_oversample_st
+ * \brief channel oversampling state, used internally
+ */
+typedef struct
+{
+	UINT8 ui8_bits;
+	UINT32 ui32_left;
+	UINT32 ui32_acc;
+	volatile UINT16 ui16_result;
+} adc_oversample_st;
+
+extern adc_oversample_st a_adc_oversample[ADC_CHANNELS_COUNT];
+#endif // ADC_OVERSAMPLING
+
+#if defined(ADC_FILTER_MEDIAN) || defined(ADC_FILTER_IIR_SHIFT) || defined(ADC_FILTER_MINMAX)
+/*!
+ * \def ADC_FILTERS
+ * \brief defined when any filter stage is enabled
+ */
+#define ADC_FILTERS
+
+/*!
+ * \fn adcIsrFilterSample(const UINT8 ui8_channel, const UINT16 ui16_value)
+ * \brief run filter chain, used internally by adcIsrStoreSample()
+ */
+VOID adcIsrFilterSample(const UINT8 ui8_channel, const UINT16 ui16_value);
+#endif // ADC_FILTER_MEDIAN || ADC_FILTER_IIR_SHIFT || ADC_FILTER_MINMAX
+
+#ifdef ADC_WINDOW
+/*!
+ * \enum e_adc_window
+ * \brief window comparator state of channel
+ */
+enum e_adc_window
+{
+	ADC_WINDOW_OFF = 0,
+	ADC_WINDOW_INSIDE,
+	ADC_WINDOW_ABOVE,
+	ADC_WINDOW_BELOW
+};
+/*!
+ * \typedef e_adc_window_t
+ * \brief window comparator state of channel
+ */
+typedef enum e_adc_window e_adc_window_t;
+
+/*!
+ * \struct adc_window_event_st
+ * \brief window event, state entered by channel and sample causing transition
+ */
+typedef struct
+{
+	UINT32 ui32_timestamp;
+	UINT16 ui16_value;
+	UINT8 ui8_channel;
+	UINT8 ui8_state;
+} adc_window_event_st;
+
+/*!
+ * \fn adcIsrWindowSample(const UINT8 ui8_channel, const UINT16 ui16_value)
+ * \brief evaluate window comparator, used internally by adcIsrStoreSample()
+ */
+VOID adcIsrWindowSample(const UINT8 ui8_channel, const UINT16 ui16_value);
+#endif // ADC_WINDOW
+
+#ifdef ADC_CAPTURE
+/*!
+ * \enum e_adc_trigger
+ * \brief capture trigger condition
+ */
+enum e_adc_trigger
+{
+	ADC_TRIGGER_NONE = 0,	// start immediately / never stop
+	ADC_TRIGGER_RISING,		// value crosses level upwards
+	ADC_TRIGGER_FALLING,	// value crosses level downwards
+	ADC_TRIGGER_SLOPE		// difference between consecutive samples reaches level
+};
+/*!
+ * \typedef e_adc_trigger_t
+ * \brief capture trigger condition
+ */
+typedef enum e_adc_trigger e_adc_trigger_t;
+
+/*!
+ * \enum e_adc_capture
+ * \brief capture state
+ */
+enum e_adc_capture
+{
+	ADC_CAPTURE_IDLE = 0,
+	ADC_CAPTURE_ARMED,
+	ADC_CAPTURE_RUNNING,
+	ADC_CAPTURE_DONE
+};
+/*!
+ * \typedef e_adc_capture_t
+ * \brief capture state
+ */
+typedef enum e_adc_capture e_adc_capture_t;
+
+/*!
+ * \struct adc_trigger_st
+ * \brief capture trigger
+ */
+typedef struct
+{
+	e_adc_trigger_t type;
+	UINT8 ui8_channel;
+	UINT16 ui16_level;
+} adc_trigger_st;
+
+/*!
+ * \struct adc_capture_sample_st
+ * \brief captured sample record
+ */
+typedef struct
+{
+	UINT32 ui32_timestamp;
+	UINT16 ui16_value;
+	UINT8 ui8_channel;
+	UINT8 ui8_reserved;
+} adc_capture_sample_st;
+
+/*!
+ * \fn adcIsrCaptureSample(const UINT8 ui8_channel, const UINT16 ui16_value)
+ * \brief evaluate triggers and queue sample, used internally by adcIsrStoreSample()
+ */
+VOID adcIsrCaptureSample(const UINT8 ui8_channel, const UINT16 ui16_value);
+#endif // ADC_CAPTURE
+
 
 /***************************************************************************
  *	FUNCTIONS
@@ -83,6 +260,192 @@ void adcIsrStop(void);
  */
 UINT16 adcIsrResult(const UINT8 ui8_channel);
 
+#ifdef ADC_OVERSAMPLING
+/*!
+ * \fn adcIsrOversampledResult(const UINT8 ui8_channel, UINT8 *pui8_bits)
+ * \brief read latest decimated value of selected logical ADC channel
+ * \param ui8_channel logical channel number
+ * \param pui8_bits resolution of returned value in bits, may be NULL
+ * \return decimated ADC value
+ */
+UINT16 adcIsrOversampledResult(const UINT8 ui8_channel, UINT8 *pui8_bits);
+/*!
+ * \fn adcIsrSetOversampling(const UINT8 ui8_channel, const UINT8 ui8_extra_bits)
+ * \brief set oversampling of selected logical ADC channel
+ * \param ui8_channel logical channel number
+ * \param ui8_extra_bits additional bits n (4^n samples per result), 0 disables oversampling
+ * \return false if resolution would exceed 16 bits, true otherwise
+ */
+BOOL adcIsrSetOversampling(const UINT8 ui8_channel, const UINT8 ui8_extra_bits);
+#endif // ADC_OVERSAMPLING
+
+#ifdef ADC_FILTERS
+/*!
+ * \fn adcIsrFiltered(const UINT8 ui8_channel)
+ * \brief read output of filter chain for selected logical ADC channel
+ * \param ui8_channel logical channel number
+ * \return filtered ADC value
+ */
+UINT16 adcIsrFiltered(const UINT8 ui8_channel);
+/*!
+ * \fn adcIsrFilterReset(const UINT8 ui8_channel)
+ * \brief restart filters of selected logical ADC channel, next sample initializes them
+ * \param ui8_channel logical channel number
+ */
+VOID adcIsrFilterReset(const UINT8 ui8_channel);
+#ifdef ADC_FILTER_MINMAX
+/*!
+ * \fn adcIsrMinMax(const UINT8 ui8_channel, UINT16 *pui16_min, UINT16 *pui16_max)
+ * \brief read min and max of median stage output in rolling window
+ * \param ui8_channel logical channel number
+ * \param pui16_min minimum destination
+ * \param pui16_max maximum destination
+ */
+VOID adcIsrMinMax(const UINT8 ui8_channel, UINT16 *pui16_min, UINT16 *pui16_max);
+#endif // ADC_FILTER_MINMAX
+#endif // ADC_FILTERS
+
+#ifdef ADC_WINDOW
+/*!
+ * \fn adcIsrWindowDisable(const UINT8 ui8_channel)
+ * \brief disable window comparator of selected logical ADC channel
+ * \param ui8_channel logical channel number
+ */
+VOID adcIsrWindowDisable(const UINT8 ui8_channel);
+/*!
+ * \fn adcIsrWindowEvent(adc_window_event_st *event)
+ * \brief take the oldest window event from queue
+ * \param event event destination
+ * \return false if queue is empty, true otherwise
+ */
+BOOL adcIsrWindowEvent(adc_window_event_st *event);
+/*!
+ * \fn adcIsrWindowOverruns
+ * \brief gets number of events lost due to full queue
+ * \return overruns count
+ */
+UINT32 adcIsrWindowOverruns(void);
+/*!
+ * \fn adcIsrWindowSet(const UINT8 ui8_channel, const UINT16 ui16_low, const UINT16 ui16_high, const UINT16 ui16_hysteresis)
+ * \brief enable window comparator of selected logical ADC channel, channel starts inside the window
+ * \param ui8_channel logical channel number
+ * \param ui16_low value below which channel enters ADC_WINDOW_BELOW state
+ * \param ui16_high value above which channel enters ADC_WINDOW_ABOVE state
+ * \param ui16_hysteresis distance from threshold required to return inside the window
+ */
+VOID adcIsrWindowSet(const UINT8 ui8_channel, const UINT16 ui16_low, const UINT16 ui16_high, const UINT16 ui16_hysteresis);
+/*!
+ * \fn adcIsrWindowState(const UINT8 ui8_channel)
+ * \brief gets window comparator state of selected logical ADC channel
+ * \param ui8_channel logical channel number
+ * \return current state
+ */
+e_adc_window_t adcIsrWindowState(const UINT8 ui8_channel);
+
+#ifdef ADC_WINDOW_HANDLER
+/*!
+ * \fn adcIsrWindowHandler(const adc_window_event_st *event)
+ * \brief user handler executed in interrupt context for each window event, event is queued regardless
+ * \param event window event
+ * \note function is unavailable if ADC_WINDOW_HANDLER is not declared in config.h
+ */
+VOID adcIsrWindowHandler(const adc_window_event_st *event);
+#endif // ADC_WINDOW_HANDLER
+#endif // ADC_WINDOW
+
+#ifdef ADC_CAPTURE
+/*!
+ * \fn adcIsrCaptureConsume(const UINT16 ui16_length)
+ * \brief release bytes obtained with adcIsrCapturePeek()
+ * \param ui16_length number of bytes
+ */
+VOID adcIsrCaptureConsume(const UINT16 ui16_length);
+/*!
+ * \fn adcIsrCaptureOverruns
+ * \brief gets number of samples lost due to full capture ring since capture start
+ * \return overruns count
+ */
+UINT32 adcIsrCaptureOverruns(void);
+/*!
+ * \fn adcIsrCapturePeek(const BYTE **ppc_data)
+ * \brief get contiguous region of captured bytes without copying
+ * \param ppc_data pointer set to region start
+ * \return region length in bytes, records may be split at ring wrap
+ */
+UINT16 adcIsrCapturePeek(const BYTE **ppc_data);
+/*!
+ * \fn adcIsrCaptureRead(adc_capture_sample_st *samples, const UINT16 ui16_count)
+ * \brief move captured samples from ring to given array
+ * \param samples destination array
+ * \param ui16_count array length
+ * \return number of samples read
+ */
+UINT16 adcIsrCaptureRead(adc_capture_sample_st *samples, const UINT16 ui16_count);
+/*!
+ * \fn adcIsrCaptureStart(const UINT32 ui32_channels, const adc_trigger_st *start, const adc_trigger_st *stop, const UINT32 ui32_samples)
+ * \brief flush capture ring and arm capture
+ * \param ui32_channels bit mask of captured logical channels
+ * \param start start trigger, NULL to start immediately
+ * \param stop stop trigger, NULL if capture is stopped only by sample count
+ * \param ui32_samples number of samples to capture, 0 for no limit
+ */
+VOID adcIsrCaptureStart(const UINT32 ui32_channels, const adc_trigger_st *start, const adc_trigger_st *stop, const UINT32 ui32_samples);
+/*!
+ * \fn adcIsrCaptureState
+ * \brief gets capture state
+ * \return current state
+ */
+e_adc_capture_t adcIsrCaptureState(void);
+/*!
+ * \fn adcIsrCaptureStop
+ * \brief stop capture, samples already queued stay in ring
+ */
+VOID adcIsrCaptureStop(void);
+#endif // ADC_CAPTURE
+
+/*!
+ * \fn adcIsrStoreSample(const UINT8 ui8_channel, const UINT8 ui8_sample, const UINT16 ui16_value)
+ * \brief store conversion result replacing the oldest sample, to be called from architecture interrupt handler
+ * \param ui8_channel logical channel number
+ * \param ui8_sample sample position
+ * \param ui16_value conversion result
+ * \note replaces direct writes to ui16_adc_measurements, which bypass running sums and filters
+ */
+static inline VOID adcIsrStoreSample(const UINT8 ui8_channel, const UINT8 ui8_sample, const UINT16 ui16_value)
+{
+	// subtract evicted sample, add new one
+	ui32_adc_sums[ui8_channel] += (UINT32)ui16_value - ui16_adc_measurements[ui8_channel][ui8_sample];
+	ui16_adc_measurements[ui8_channel][ui8_sample] = ui16_value;
+
+#ifdef ADC_WINDOW
+	adcIsrWindowSample(ui8_channel, ui16_value);
+#endif // ADC_WINDOW
+
+#ifdef ADC_OVERSAMPLING
+	adc_oversample_st *os = &a_adc_oversample[ui8_channel];
+
+	// decimate once 4^n samples are accumulated
+	if (os->ui8_bits)
+	{
+		os->ui32_acc += ui16_value;
+		if (!--os->ui32_left)
+		{
+			os->ui16_result = os->ui32_acc >> os->ui8_bits;
+			os->ui32_acc = 0;
+			os->ui32_left = (UINT32)1 << (2 * os->ui8_bits);
+		}
+	}
+#endif // ADC_OVERSAMPLING
+
+#ifdef ADC_FILTERS
+	adcIsrFilterSample(ui8_channel, ui16_value);
+#endif // ADC_FILTERS
+
+#ifdef ADC_CAPTURE
+	adcIsrCaptureSample(ui8_channel, ui16_value);
+#endif // ADC_CAPTURE
+}
+
 #endif // _ADC_ISR_H
 
 // END
@@ -26,6 +26,28 @@
 #include "ehal/chksum/chksum.h"
 #include "ehal/global.h"
 
+#include <string.h>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif // __AVX2__ || __SSE2__
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+// every second byte of word, lanes of 16 bits
+#define CHKSUM_WORD_LANES ((_WORD)~(_WORD)0 / 0xFFFF * 0xFF)
+// words summed before 16-bit lanes are folded, each word adds up to 2 * 0xFF to lane
+#define CHKSUM_WORD_FOLD 128
+
+// bytes after which 16-bit Fletcher sums have to be reduced (second sum grows quadratically)
+#define CHKSUM_FLETCHER16_BLOCK 21
+// bytes after which 32-bit Adler sums have to be reduced (as NMAX in zlib)
+#define CHKSUM_ADLER32_BLOCK 5552
+#define CHKSUM_ADLER32_MOD 65521UL
+
 
 /***************************************************************************
  *	FUNCTIONS
@@ -45,12 +67,123 @@ CHKSUM_CHECKSUM8BIT_ATTR BYTE checksum8Bit(BYTE* pc_ptr, const UINT16 ui16_lengt
 // --------------------------------------------------------------------------
 CHKSUM_CHECKSUM16BIT_ATTR UINT16 checksum16Bit(BYTE* pc_ptr, const UINT32 ui32_length)
 {
-	UINT16 c_chksum = 0;
+	const BYTE *pc_end = pc_ptr + ui32_length;
+	UINT32 ui32_chksum = 0;
 
-	for (UINT32 i = 0; i < ui32_length; ++i)
-		c_chksum += *pc_ptr++;
+	// only low 16 bits of sum are returned, so partial sums may be added in any order and truncated
+#if defined(__AVX2__)
+	__m256i v_sum = _mm256_setzero_si256();
+	__m128i v_half;
 
-	return (c_chksum);
+	// sad against zero sums each 8 bytes into 64-bit lane, which never overflows
+	for (; (pc_end - pc_ptr) >= 32; pc_ptr += 32)
+		v_sum = _mm256_add_epi64(v_sum, _mm256_sad_epu8(_mm256_loadu_si256((const __m256i *)pc_ptr), _mm256_setzero_si256()));
+	v_half = _mm_add_epi64(_mm256_castsi256_si128(v_sum), _mm256_extracti128_si256(v_sum, 1));
+	ui32_chksum += _mm_cvtsi128_si32(v_half) + _mm_cvtsi128_si32(_mm_unpackhi_epi64(v_half, v_half));
+#elif defined(__SSE2__)
+	__m128i v_sum = _mm_setzero_si128();
+
+	// sad against zero sums each 8 bytes into 64-bit lane, which never overflows
+	for (; (pc_end - pc_ptr) >= 16; pc_ptr += 16)
+		v_sum = _mm_add_epi64(v_sum, _mm_sad_epu8(_mm_loadu_si128((const __m128i *)pc_ptr), _mm_setzero_si128()));
+	ui32_chksum += _mm_cvtsi128_si32(v_sum) + _mm_cvtsi128_si32(_mm_unpackhi_epi64(v_sum, v_sum));
+#endif // __AVX2__ || __SSE2__
+
+	// word at a time is not worth it below 32-bit words
+	if (sizeof(_WORD) >= 4)
+	{
+		// leading bytes up to word boundary
+		for (; (pc_ptr < pc_end) && ((uintptr_t)pc_ptr & (sizeof(_WORD) - 1)); ++pc_ptr)
+			ui32_chksum += *pc_ptr;
+
+		// odd and even bytes are added in parallel into 16-bit lanes, folded before lane may overflow
+		while ((UINT32)(pc_end - pc_ptr) >= sizeof(_WORD))
+		{
+			UINT32 ui32_words = (pc_end - pc_ptr) / sizeof(_WORD);
+			_WORD w_lanes = 0;
+			_WORD w_word;
+
+			if (ui32_words > CHKSUM_WORD_FOLD)
+				ui32_words = CHKSUM_WORD_FOLD;
+
+			// memcpy keeps strict aliasing and compiles to single aligned load
+			for (; ui32_words; --ui32_words, pc_ptr += sizeof(_WORD))
+			{
+				memcpy(&w_word, pc_ptr, sizeof(_WORD));
+				w_lanes += (w_word & CHKSUM_WORD_LANES) + ((w_word >> 8) & CHKSUM_WORD_LANES);
+			}
+
+			for (UINT8 i = sizeof(_WORD) / 2; i; --i, w_lanes >>= 16)
+				ui32_chksum += (UINT16)w_lanes;
+		}
+	}
+
+	while (pc_ptr < pc_end)
+		ui32_chksum += *pc_ptr++;
+
+	return (ui32_chksum);
+}
+
+// --------------------------------------------------------------------------
+CHKSUM_FLETCHER16_ATTR UINT16 checksumFletcher16Update(const UINT16 ui16_chksum, const BYTE *pc_ptr, const UINT32 ui32_length)
+{
+	const BYTE *pc_end = pc_ptr + ui32_length;
+	UINT16 ui16_sum1 = ui16_chksum & 0xFF;
+	UINT16 ui16_sum2 = ui16_chksum >> 8;
+
+	while (pc_ptr < pc_end)
+	{
+		UINT32 ui32_block = pc_end - pc_ptr;
+
+		if (ui32_block > CHKSUM_FLETCHER16_BLOCK)
+			ui32_block = CHKSUM_FLETCHER16_BLOCK;
+
+		for (UINT8 i = ui32_block; i; --i)
+		{
+			ui16_sum1 += *pc_ptr++;
+			ui16_sum2 += ui16_sum1;
+		}
+
+		// 256 = 1 (mod 255), two folds give value in 0..255
+		ui16_sum1 = (ui16_sum1 & 0xFF) + (ui16_sum1 >> 8);
+		ui16_sum1 = (ui16_sum1 & 0xFF) + (ui16_sum1 >> 8);
+		ui16_sum2 = (ui16_sum2 & 0xFF) + (ui16_sum2 >> 8);
+		ui16_sum2 = (ui16_sum2 & 0xFF) + (ui16_sum2 >> 8);
+	}
+
+	if (ui16_sum1 == 0xFF)
+		ui16_sum1 = 0;
+	if (ui16_sum2 == 0xFF)
+		ui16_sum2 = 0;
+
+	return ((ui16_sum2 << 8) | ui16_sum1);
+}
+
+// --------------------------------------------------------------------------
+CHKSUM_ADLER32_ATTR UINT32 checksumAdler32Update(const UINT32 ui32_chksum, const BYTE *pc_ptr, const UINT32 ui32_length)
+{
+	const BYTE *pc_end = pc_ptr + ui32_length;
+	UINT32 ui32_a = ui32_chksum & 0xFFFF;
+	UINT32 ui32_b = ui32_chksum >> 16;
+
+	while (pc_ptr < pc_end)
+	{
+		UINT32 ui32_block = pc_end - pc_ptr;
+
+		if (ui32_block > CHKSUM_ADLER32_BLOCK)
+			ui32_block = CHKSUM_ADLER32_BLOCK;
+
+		for (UINT16 i = ui32_block; i; --i)
+		{
+			ui32_a += *pc_ptr++;
+			ui32_b += ui32_a;
+		}
+
+		ui32_a %= CHKSUM_ADLER32_MOD;
+		ui32_b %= CHKSUM_ADLER32_MOD;
+	}
+
+	return ((ui32_b << 16) | ui32_a);
 }
 
 // END
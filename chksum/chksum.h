@@ -19,6 +19,15 @@
 #include "lib_func_attr.h"
 
 
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+// initial values of streaming checksums
+#define CHKSUM_FLETCHER16_INIT 0x0000
+#define CHKSUM_ADLER32_INIT 0x00000001UL
+
+
 /***************************************************************************
  *	FUNCTIONS
  ***************************************************************************/
@@ -37,9 +46,55 @@ CHKSUM_CHECKSUM8BIT_ATTR BYTE checksum8Bit(BYTE* pc_ptr, const UINT16 ui16_lengt
  * \param pc_ptr buffer pointer
  * \param ui32_length number of bytes of buffer to process
  * \return byte of checksum (added bytes with no carry)
+ * \note buffer is summed in aligned machine words (_WORD), with SSE2/AVX2 where compiler targets it
  */
 CHKSUM_CHECKSUM16BIT_ATTR UINT16 checksum16Bit(BYTE* pc_ptr, const UINT32 ui32_length);
 
+/*!
+ * \fn checksumFletcher16Update(const UINT16 ui16_chksum, const BYTE *pc_ptr, const UINT32 ui32_length)
+ * \brief update Fletcher-16 checksum with next chunk of data
+ * \param ui16_chksum CHKSUM_FLETCHER16_INIT or value returned by previous update
+ * \param pc_ptr buffer pointer
+ * \param ui32_length number of bytes of buffer to process
+ * \return checksum of data processed so far (second sum in high byte)
+ * \note unlike checksum8Bit() detects swapped bytes and most compensating errors, only 16-bit additions
+ * are used and modulo is taken every 21 bytes, so it is cheap on 8-bit cpus
+ */
+CHKSUM_FLETCHER16_ATTR UINT16 checksumFletcher16Update(const UINT16 ui16_chksum, const BYTE *pc_ptr, const UINT32 ui32_length);
+/*!
+ * \fn checksumAdler32Update(const UINT32 ui32_chksum, const BYTE *pc_ptr, const UINT32 ui32_length)
+ * \brief update Adler-32 checksum with next chunk of data
+ * \param ui32_chksum CHKSUM_ADLER32_INIT or value returned by previous update
+ * \param pc_ptr buffer pointer
+ * \param ui32_length number of bytes of buffer to process
+ * \return checksum of data processed so far (as zlib adler32())
+ * \note modulo is taken every 5552 bytes
+ */
+CHKSUM_ADLER32_ATTR UINT32 checksumAdler32Update(const UINT32 ui32_chksum, const BYTE *pc_ptr, const UINT32 ui32_length);
+
+/*!
+ * \fn checksumFletcher16(const BYTE *pc_ptr, const UINT32 ui32_length)
+ * \brief calculate Fletcher-16 checksum of buffer
+ * \param pc_ptr buffer pointer
+ * \param ui32_length number of bytes of buffer to process
+ * \return checksum of buffer
+ */
+static inline UINT16 checksumFletcher16(const BYTE *pc_ptr, const UINT32 ui32_length)
+{
+	return (checksumFletcher16Update(CHKSUM_FLETCHER16_INIT, pc_ptr, ui32_length));
+}
+/*!
+ * \fn checksumAdler32(const BYTE *pc_ptr, const UINT32 ui32_length)
+ * \brief calculate Adler-32 checksum of buffer
+ * \param pc_ptr buffer pointer
+ * \param ui32_length number of bytes of buffer to process
+ * \return checksum of buffer
+ */
+static inline UINT32 checksumAdler32(const BYTE *pc_ptr, const UINT32 ui32_length)
+{
+	return (checksumAdler32Update(CHKSUM_ADLER32_INIT, pc_ptr, ui32_length));
+}
+
 #endif // _CHKSUM_H
 
 // END
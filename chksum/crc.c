@@ -0,0 +1,335 @@
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+/*!
+ * \file crc.c
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief Cyclic redundancy check functions - implementation
+ * \note
+ * For detailed description see header file.
+ */
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#include "ehal/chksum/crc.h"
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+// backends selection
+#ifndef CRC_BACKEND
+#define CRC_BACKEND CRC_TABLE
+#endif // CRC_BACKEND
+
+#ifndef CRC8_BACKEND
+#define CRC8_BACKEND CRC_BACKEND
+#endif // CRC8_BACKEND
+
+#ifndef CRC16_CCITT_BACKEND
+#define CRC16_CCITT_BACKEND CRC_BACKEND
+#endif // CRC16_CCITT_BACKEND
+
+#ifndef CRC16_MODBUS_BACKEND
+#define CRC16_MODBUS_BACKEND CRC_BACKEND
+#endif // CRC16_MODBUS_BACKEND
+
+#ifndef CRC32_BACKEND
+#define CRC32_BACKEND CRC_BACKEND
+#endif // CRC32_BACKEND
+
+#if ((CRC8_BACKEND < CRC_BITWISE) || (CRC8_BACKEND > CRC_SLICE8) || (CRC16_CCITT_BACKEND < CRC_BITWISE) || (CRC16_CCITT_BACKEND > CRC_SLICE8) \
+	|| (CRC16_MODBUS_BACKEND < CRC_BITWISE) || (CRC16_MODBUS_BACKEND > CRC_SLICE8) || (CRC32_BACKEND < CRC_BITWISE) || (CRC32_BACKEND > CRC_SLICE8))
+	#error "CRC: unknown backend selected!"
+#endif
+
+#if defined(CRC32_HW_EMULATE) && !defined(CRC32_HW)
+	#error "CRC: CRC32_HW_EMULATE requires CRC32_HW"
+#endif
+
+// number of 256 entries tables used by backend
+#if (CRC8_BACKEND == CRC_SLICE8)
+	#define CRC8_TABLES 8
+#elif (CRC8_BACKEND == CRC_SLICE4)
+	#define CRC8_TABLES 4
+#elif (CRC8_BACKEND == CRC_TABLE)
+	#define CRC8_TABLES 1
+#endif
+
+#if (CRC16_CCITT_BACKEND == CRC_SLICE8)
+	#define CRC16_CCITT_TABLES 8
+#elif (CRC16_CCITT_BACKEND == CRC_SLICE4)
+	#define CRC16_CCITT_TABLES 4
+#elif (CRC16_CCITT_BACKEND == CRC_TABLE)
+	#define CRC16_CCITT_TABLES 1
+#endif
+
+#if (CRC16_MODBUS_BACKEND == CRC_SLICE8)
+	#define CRC16_MODBUS_TABLES 8
+#elif (CRC16_MODBUS_BACKEND == CRC_SLICE4)
+	#define CRC16_MODBUS_TABLES 4
+#elif (CRC16_MODBUS_BACKEND == CRC_TABLE)
+	#define CRC16_MODBUS_TABLES 1
+#endif
+
+#if (CRC32_BACKEND == CRC_SLICE8)
+	#define CRC32_TABLES 8
+#elif (CRC32_BACKEND == CRC_SLICE4)
+	#define CRC32_TABLES 4
+#elif (CRC32_BACKEND == CRC_TABLE)
+	#define CRC32_TABLES 1
+#endif
+
+#include "ehal/chksum/crc_tab.h"
+
+// nibble tables
+#if (CRC8_BACKEND == CRC_NIBBLE)
+static const UINT8 aui8_crc8_nibble[16] = {
+	0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15,
+	0x38, 0x3F, 0x36, 0x31, 0x24, 0x23, 0x2A, 0x2D
+};
+#endif // CRC8_BACKEND
+
+#if (CRC16_CCITT_BACKEND == CRC_NIBBLE)
+static const UINT16 aui16_crc16_ccitt_nibble[16] = {
+	0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+	0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+#endif // CRC16_CCITT_BACKEND
+
+#if (CRC16_MODBUS_BACKEND == CRC_NIBBLE)
+static const UINT16 aui16_crc16_modbus_nibble[16] = {
+	0x0000, 0xCC01, 0xD801, 0x1400, 0xF001, 0x3C00, 0x2800, 0xE401,
+	0xA001, 0x6C00, 0x7800, 0xB401, 0x5000, 0x9C01, 0x8801, 0x4400
+};
+#endif // CRC16_MODBUS_BACKEND
+
+#if (CRC32_BACKEND == CRC_NIBBLE)
+static const UINT32 aui32_crc32_nibble[16] = {
+	0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+	0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+};
+#endif // CRC32_BACKEND
+
+#ifdef CRC32_HW_EMULATE
+// static functions
+static UINT32 crc_bitReverse(UINT32 ui32_value);
+#endif // CRC32_HW_EMULATE
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+// --------------------------------------------------------------------------
+UINT8 crc8Update(UINT8 ui8_crc, const BYTE *pc_ptr, const UINT32 ui32_length)
+{
+	const BYTE *pc_end = pc_ptr + ui32_length;
+
+#if (CRC8_BACKEND >= CRC_SLICE4)
+	// crc is merged with the first byte of block, remaining bytes are looked up directly
+	for (; (pc_end - pc_ptr) >= CRC8_TABLES; pc_ptr += CRC8_TABLES)
+	{
+#if (CRC8_TABLES == 8)
+		ui8_crc = aui8_crc8_table[7][ui8_crc ^ pc_ptr[0]] ^ aui8_crc8_table[6][pc_ptr[1]]
+			^ aui8_crc8_table[5][pc_ptr[2]] ^ aui8_crc8_table[4][pc_ptr[3]]
+			^ aui8_crc8_table[3][pc_ptr[4]] ^ aui8_crc8_table[2][pc_ptr[5]]
+			^ aui8_crc8_table[1][pc_ptr[6]] ^ aui8_crc8_table[0][pc_ptr[7]];
+#else
+		ui8_crc = aui8_crc8_table[3][ui8_crc ^ pc_ptr[0]] ^ aui8_crc8_table[2][pc_ptr[1]]
+			^ aui8_crc8_table[1][pc_ptr[2]] ^ aui8_crc8_table[0][pc_ptr[3]];
+#endif // CRC8_TABLES
+	}
+#endif // CRC8_BACKEND
+
+	while (pc_ptr < pc_end)
+	{
+#if (CRC8_BACKEND >= CRC_TABLE)
+		ui8_crc = aui8_crc8_table[0][ui8_crc ^ *pc_ptr++];
+#elif (CRC8_BACKEND == CRC_NIBBLE)
+		ui8_crc ^= *pc_ptr++;
+		ui8_crc = (ui8_crc << 4) ^ aui8_crc8_nibble[ui8_crc >> 4];
+		ui8_crc = (ui8_crc << 4) ^ aui8_crc8_nibble[ui8_crc >> 4];
+#else
+		ui8_crc ^= *pc_ptr++;
+		for (UINT8 i = 0; i < 8; ++i)
+			ui8_crc = (ui8_crc & 0x80)?((ui8_crc << 1) ^ 0x07):(ui8_crc << 1);
+#endif // CRC8_BACKEND
+	}
+
+	return (ui8_crc);
+}
+
+// --------------------------------------------------------------------------
+UINT16 crc16CcittUpdate(UINT16 ui16_crc, const BYTE *pc_ptr, const UINT32 ui32_length)
+{
+	const BYTE *pc_end = pc_ptr + ui32_length;
+
+#if (CRC16_CCITT_BACKEND >= CRC_SLICE4)
+	// crc is merged with the first two bytes of block (high byte first), remaining bytes are looked up directly
+	for (; (pc_end - pc_ptr) >= CRC16_CCITT_TABLES; pc_ptr += CRC16_CCITT_TABLES)
+	{
+		ui16_crc ^= ((UINT16)pc_ptr[0] << 8) | pc_ptr[1];
+#if (CRC16_CCITT_TABLES == 8)
+		ui16_crc = aui16_crc16_ccitt_table[7][ui16_crc >> 8] ^ aui16_crc16_ccitt_table[6][ui16_crc & 0xFF]
+			^ aui16_crc16_ccitt_table[5][pc_ptr[2]] ^ aui16_crc16_ccitt_table[4][pc_ptr[3]]
+			^ aui16_crc16_ccitt_table[3][pc_ptr[4]] ^ aui16_crc16_ccitt_table[2][pc_ptr[5]]
+			^ aui16_crc16_ccitt_table[1][pc_ptr[6]] ^ aui16_crc16_ccitt_table[0][pc_ptr[7]];
+#else
+		ui16_crc = aui16_crc16_ccitt_table[3][ui16_crc >> 8] ^ aui16_crc16_ccitt_table[2][ui16_crc & 0xFF]
+			^ aui16_crc16_ccitt_table[1][pc_ptr[2]] ^ aui16_crc16_ccitt_table[0][pc_ptr[3]];
+#endif // CRC16_CCITT_TABLES
+	}
+#endif // CRC16_CCITT_BACKEND
+
+	while (pc_ptr < pc_end)
+	{
+#if (CRC16_CCITT_BACKEND >= CRC_TABLE)
+		ui16_crc = (ui16_crc << 8) ^ aui16_crc16_ccitt_table[0][(ui16_crc >> 8) ^ *pc_ptr++];
+#elif (CRC16_CCITT_BACKEND == CRC_NIBBLE)
+		ui16_crc ^= (UINT16)*pc_ptr++ << 8;
+		ui16_crc = (ui16_crc << 4) ^ aui16_crc16_ccitt_nibble[ui16_crc >> 12];
+		ui16_crc = (ui16_crc << 4) ^ aui16_crc16_ccitt_nibble[ui16_crc >> 12];
+#else
+		ui16_crc ^= (UINT16)*pc_ptr++ << 8;
+		for (UINT8 i = 0; i < 8; ++i)
+			ui16_crc = (ui16_crc & 0x8000)?((ui16_crc << 1) ^ 0x1021):(ui16_crc << 1);
+#endif // CRC16_CCITT_BACKEND
+	}
+
+	return (ui16_crc);
+}
+
+// --------------------------------------------------------------------------
+UINT16 crc16ModbusUpdate(UINT16 ui16_crc, const BYTE *pc_ptr, const UINT32 ui32_length)
+{
+	const BYTE *pc_end = pc_ptr + ui32_length;
+
+#if (CRC16_MODBUS_BACKEND >= CRC_SLICE4)
+	// crc is merged with the first two bytes of block (low byte first), remaining bytes are looked up directly
+	for (; (pc_end - pc_ptr) >= CRC16_MODBUS_TABLES; pc_ptr += CRC16_MODBUS_TABLES)
+	{
+		ui16_crc ^= pc_ptr[0] | ((UINT16)pc_ptr[1] << 8);
+#if (CRC16_MODBUS_TABLES == 8)
+		ui16_crc = aui16_crc16_modbus_table[7][ui16_crc & 0xFF] ^ aui16_crc16_modbus_table[6][ui16_crc >> 8]
+			^ aui16_crc16_modbus_table[5][pc_ptr[2]] ^ aui16_crc16_modbus_table[4][pc_ptr[3]]
+			^ aui16_crc16_modbus_table[3][pc_ptr[4]] ^ aui16_crc16_modbus_table[2][pc_ptr[5]]
+			^ aui16_crc16_modbus_table[1][pc_ptr[6]] ^ aui16_crc16_modbus_table[0][pc_ptr[7]];
+#else
+		ui16_crc = aui16_crc16_modbus_table[3][ui16_crc & 0xFF] ^ aui16_crc16_modbus_table[2][ui16_crc >> 8]
+			^ aui16_crc16_modbus_table[1][pc_ptr[2]] ^ aui16_crc16_modbus_table[0][pc_ptr[3]];
+#endif // CRC16_MODBUS_TABLES
+	}
+#endif // CRC16_MODBUS_BACKEND
+
+	while (pc_ptr < pc_end)
+	{
+#if (CRC16_MODBUS_BACKEND >= CRC_TABLE)
+		ui16_crc = (ui16_crc >> 8) ^ aui16_crc16_modbus_table[0][(ui16_crc ^ *pc_ptr++) & 0xFF];
+#elif (CRC16_MODBUS_BACKEND == CRC_NIBBLE)
+		ui16_crc ^= *pc_ptr++;
+		ui16_crc = (ui16_crc >> 4) ^ aui16_crc16_modbus_nibble[ui16_crc & 0x0F];
+		ui16_crc = (ui16_crc >> 4) ^ aui16_crc16_modbus_nibble[ui16_crc & 0x0F];
+#else
+		ui16_crc ^= *pc_ptr++;
+		for (UINT8 i = 0; i < 8; ++i)
+			ui16_crc = (ui16_crc & 0x0001)?((ui16_crc >> 1) ^ 0xA001):(ui16_crc >> 1);
+#endif // CRC16_MODBUS_BACKEND
+	}
+
+	return (ui16_crc);
+}
+
+// --------------------------------------------------------------------------
+UINT32 crc32Update(UINT32 ui32_crc, const BYTE *pc_ptr, const UINT32 ui32_length)
+{
+	const BYTE *pc_end = pc_ptr + ui32_length;
+
+#ifdef CRC32_HW
+	// peripheral setup does not pay off for short blocks
+	if ((ui32_length >= CRC32_HW_MIN) && march_crc32Update(&ui32_crc, pc_ptr, ui32_length))
+		return (ui32_crc);
+#endif // CRC32_HW
+
+#if (CRC32_BACKEND >= CRC_SLICE4)
+	// crc is merged with the first four bytes of block (low byte first), remaining bytes are looked up directly,
+	// byte composition keeps it independent of alignment and endianness
+	for (; (pc_end - pc_ptr) >= CRC32_TABLES; pc_ptr += CRC32_TABLES)
+	{
+		ui32_crc ^= pc_ptr[0] | ((UINT32)pc_ptr[1] << 8) | ((UINT32)pc_ptr[2] << 16) | ((UINT32)pc_ptr[3] << 24);
+#if (CRC32_TABLES == 8)
+		ui32_crc = aui32_crc32_table[7][ui32_crc & 0xFF] ^ aui32_crc32_table[6][(ui32_crc >> 8) & 0xFF]
+			^ aui32_crc32_table[5][(ui32_crc >> 16) & 0xFF] ^ aui32_crc32_table[4][ui32_crc >> 24]
+			^ aui32_crc32_table[3][pc_ptr[4]] ^ aui32_crc32_table[2][pc_ptr[5]]
+			^ aui32_crc32_table[1][pc_ptr[6]] ^ aui32_crc32_table[0][pc_ptr[7]];
+#else
+		ui32_crc = aui32_crc32_table[3][ui32_crc & 0xFF] ^ aui32_crc32_table[2][(ui32_crc >> 8) & 0xFF]
+			^ aui32_crc32_table[1][(ui32_crc >> 16) & 0xFF] ^ aui32_crc32_table[0][ui32_crc >> 24];
+#endif // CRC32_TABLES
+	}
+#endif // CRC32_BACKEND
+
+	while (pc_ptr < pc_end)
+	{
+#if (CRC32_BACKEND >= CRC_TABLE)
+		ui32_crc = (ui32_crc >> 8) ^ aui32_crc32_table[0][(ui32_crc ^ *pc_ptr++) & 0xFF];
+#elif (CRC32_BACKEND == CRC_NIBBLE)
+		ui32_crc ^= *pc_ptr++;
+		ui32_crc = (ui32_crc >> 4) ^ aui32_crc32_nibble[ui32_crc & 0x0F];
+		ui32_crc = (ui32_crc >> 4) ^ aui32_crc32_nibble[ui32_crc & 0x0F];
+#else
+		ui32_crc ^= *pc_ptr++;
+		for (UINT8 i = 0; i < 8; ++i)
+			ui32_crc = (ui32_crc & 1)?((ui32_crc >> 1) ^ 0xEDB88320UL):(ui32_crc >> 1);
+#endif // CRC32_BACKEND
+	}
+
+	return (ui32_crc);
+}
+
+#ifdef CRC32_HW_EMULATE
+// --------------------------------------------------------------------------
+BOOL march_crc32Update(UINT32 *pui32_crc, const BYTE *pc_ptr, const UINT32 ui32_length)
+{
+	// typical peripheral shifts msb first, reflected CRC is obtained by reversing input bytes and result
+	UINT32 ui32_reg = crc_bitReverse(*pui32_crc);
+
+	for (UINT32 i = 0; i < ui32_length; ++i)
+	{
+		ui32_reg ^= crc_bitReverse(pc_ptr[i]);
+		for (UINT8 j = 0; j < 8; ++j)
+			ui32_reg = (ui32_reg & 0x80000000UL)?((ui32_reg << 1) ^ 0x04C11DB7UL):(ui32_reg << 1);
+	}
+
+	*pui32_crc = crc_bitReverse(ui32_reg);
+
+	return (true);
+}
+
+// static functions
+// --------------------------------------------------------------------------
+static UINT32 crc_bitReverse(UINT32 ui32_value)
+{
+	ui32_value = ((ui32_value >> 1) & 0x55555555UL) | ((ui32_value & 0x55555555UL) << 1);
+	ui32_value = ((ui32_value >> 2) & 0x33333333UL) | ((ui32_value & 0x33333333UL) << 2);
+	ui32_value = ((ui32_value >> 4) & 0x0F0F0F0FUL) | ((ui32_value & 0x0F0F0F0FUL) << 4);
+	ui32_value = ((ui32_value >> 8) & 0x00FF00FFUL) | ((ui32_value & 0x00FF00FFUL) << 8);
+
+	return ((ui32_value >> 16) | (ui32_value << 16));
+}
+#endif // CRC32_HW_EMULATE
+
+// END
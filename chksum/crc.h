@@ -0,0 +1,253 @@
+/*!
+ * \file crc.h
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief Cyclic redundancy check functions - definitions
+ * \details
+ * CRC-8 (poly 0x07, init 0x00), CRC-16/CCITT (poly 0x1021, init 0xFFFF, known as CCITT-FALSE),
+ * CRC-16/MODBUS (reflected poly 0x8005, init 0xFFFF) and CRC-32 (reflected poly 0x04C11DB7, init and
+ * final xor 0xFFFFFFFF, as used by zlib/ethernet). Unlike additive checksums they detect swapped bytes and
+ * all burst errors up to CRC width.
+ *
+ * Each CRC has incremental interface: value returned by xxxInit() is passed through any number of
+ * xxxUpdate() calls with consecutive data chunks and converted with xxxFinal(), so streamed data does
+ * not have to be buffered. xxx() computes CRC of single buffer.
+ *
+ * Optional definitions in config.h select implementation (backend), trading flash for speed:
+ * - CRC_BACKEND - default backend for all CRCs (default CRC_TABLE):
+ *   - CRC_BITWISE - bit by bit, no table
+ *   - CRC_NIBBLE - 16 entries table, two lookups per byte
+ *   - CRC_TABLE - 256 entries table, single lookup per byte
+ *   - CRC_SLICE4 - 4 x 256 entries tables, 4 bytes per step
+ *   - CRC_SLICE8 - 8 x 256 entries tables, 8 bytes per step (host and bigger MCUs)
+ * - CRC8_BACKEND, CRC16_CCITT_BACKEND, CRC16_MODBUS_BACKEND, CRC32_BACKEND - override backend for
+ *   particular CRC
+ * - CRC32_HW - CRC-32 is computed by CRC peripheral with march_crc32Update(), selected backend is used for
+ *   blocks shorter than CRC32_HW_MIN (default 32 bytes) or when peripheral is not available
+ * - CRC32_HW_EMULATE - software model of CRC peripheral (msb first unit with bit reversal of input and
+ *   output) implements march_crc32Update(), used on host to verify CRC32_HW path
+ *
+ * \note
+ * All backends give identical results. Only tables of selected backends are linked.
+ * \warning
+ * With CRC32_HW implementation for particular architecture is contained in crc_march.c, which implements
+ * march_crc32Update() (e.g. peripheral fed by DMA for large blocks).
+ */
+
+#ifndef _CRC_H
+#define _CRC_H
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#include "config.h"
+#include "ehal/global.h"
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+// backends
+#define CRC_BITWISE 0
+#define CRC_NIBBLE 1
+#define CRC_TABLE 2
+#define CRC_SLICE4 3
+#define CRC_SLICE8 4
+
+// initial values
+#define CRC8_INIT 0x00
+#define CRC16_CCITT_INIT 0xFFFF
+#define CRC16_MODBUS_INIT 0xFFFF
+#define CRC32_INIT 0xFFFFFFFFUL
+
+#ifndef CRC32_HW_MIN
+#define CRC32_HW_MIN 32
+#endif // CRC32_HW_MIN
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+/*!
+ * \fn crc8Update(UINT8 ui8_crc, const BYTE *pc_ptr, const UINT32 ui32_length)
+ * \brief update CRC-8 with next chunk of data
+ * \param ui8_crc value returned by crc8Init() or previous update
+ * \param pc_ptr buffer pointer
+ * \param ui32_length number of bytes of buffer to process
+ * \return updated CRC
+ */
+UINT8 crc8Update(UINT8 ui8_crc, const BYTE *pc_ptr, const UINT32 ui32_length);
+/*!
+ * \fn crc16CcittUpdate(UINT16 ui16_crc, const BYTE *pc_ptr, const UINT32 ui32_length)
+ * \brief update CRC-16/CCITT with next chunk of data
+ * \param ui16_crc value returned by crc16CcittInit() or previous update
+ * \param pc_ptr buffer pointer
+ * \param ui32_length number of bytes of buffer to process
+ * \return updated CRC
+ */
+UINT16 crc16CcittUpdate(UINT16 ui16_crc, const BYTE *pc_ptr, const UINT32 ui32_length);
+/*!
+ * \fn crc16ModbusUpdate(UINT16 ui16_crc, const BYTE *pc_ptr, const UINT32 ui32_length)
+ * \brief update CRC-16/MODBUS with next chunk of data
+ * \param ui16_crc value returned by crc16ModbusInit() or previous update
+ * \param pc_ptr buffer pointer
+ * \param ui32_length number of bytes of buffer to process
+ * \return updated CRC
+ */
+UINT16 crc16ModbusUpdate(UINT16 ui16_crc, const BYTE *pc_ptr, const UINT32 ui32_length);
+/*!
+ * \fn crc32Update(UINT32 ui32_crc, const BYTE *pc_ptr, const UINT32 ui32_length)
+ * \brief update CRC-32 with next chunk of data
+ * \param ui32_crc value returned by crc32Init() or previous update
+ * \param pc_ptr buffer pointer
+ * \param ui32_length number of bytes of buffer to process
+ * \return updated CRC
+ */
+UINT32 crc32Update(UINT32 ui32_crc, const BYTE *pc_ptr, const UINT32 ui32_length);
+
+#ifdef CRC32_HW
+/*!
+ * \fn march_crc32Update(UINT32 *pui32_crc, const BYTE *pc_ptr, const UINT32 ui32_length)
+ * \brief update CRC-32 using CRC peripheral, implemented in crc_march.c
+ * \param pui32_crc CRC as used by crc32Update() (reflected, not finalized), updated in place
+ * \param pc_ptr buffer pointer
+ * \param ui32_length number of bytes of buffer to process
+ * \return false if peripheral is not available (e.g. busy) and CRC was not updated, true otherwise
+ * \note function is unavailable if CRC32_HW is not declared in config.h
+ */
+BOOL march_crc32Update(UINT32 *pui32_crc, const BYTE *pc_ptr, const UINT32 ui32_length);
+#endif // CRC32_HW
+
+/*!
+ * \fn crc8Init
+ * \brief start CRC-8 computation
+ * \return initial CRC
+ */
+static inline UINT8 crc8Init(void)
+{
+	return (CRC8_INIT);
+}
+/*!
+ * \fn crc8Final(const UINT8 ui8_crc)
+ * \brief finish CRC-8 computation
+ * \param ui8_crc updated CRC
+ * \return CRC of data
+ */
+static inline UINT8 crc8Final(const UINT8 ui8_crc)
+{
+	return (ui8_crc);
+}
+/*!
+ * \fn crc8(const BYTE *pc_ptr, const UINT32 ui32_length)
+ * \brief calculate CRC-8 of buffer
+ * \param pc_ptr buffer pointer
+ * \param ui32_length number of bytes of buffer to process
+ * \return CRC of buffer
+ */
+static inline UINT8 crc8(const BYTE *pc_ptr, const UINT32 ui32_length)
+{
+	return (crc8Final(crc8Update(crc8Init(), pc_ptr, ui32_length)));
+}
+
+/*!
+ * \fn crc16CcittInit
+ * \brief start CRC-16/CCITT computation
+ * \return initial CRC
+ */
+static inline UINT16 crc16CcittInit(void)
+{
+	return (CRC16_CCITT_INIT);
+}
+/*!
+ * \fn crc16CcittFinal(const UINT16 ui16_crc)
+ * \brief finish CRC-16/CCITT computation
+ * \param ui16_crc updated CRC
+ * \return CRC of data
+ */
+static inline UINT16 crc16CcittFinal(const UINT16 ui16_crc)
+{
+	return (ui16_crc);
+}
+/*!
+ * \fn crc16Ccitt(const BYTE *pc_ptr, const UINT32 ui32_length)
+ * \brief calculate CRC-16/CCITT of buffer
+ * \param pc_ptr buffer pointer
+ * \param ui32_length number of bytes of buffer to process
+ * \return CRC of buffer
+ */
+static inline UINT16 crc16Ccitt(const BYTE *pc_ptr, const UINT32 ui32_length)
+{
+	return (crc16CcittFinal(crc16CcittUpdate(crc16CcittInit(), pc_ptr, ui32_length)));
+}
+
+/*!
+ * \fn crc16ModbusInit
+ * \brief start CRC-16/MODBUS computation
+ * \return initial CRC
+ */
+static inline UINT16 crc16ModbusInit(void)
+{
+	return (CRC16_MODBUS_INIT);
+}
+/*!
+ * \fn crc16ModbusFinal(const UINT16 ui16_crc)
+ * \brief finish CRC-16/MODBUS computation
+ * \param ui16_crc updated CRC
+ * \return CRC of data, transmitted low byte first
+ */
+static inline UINT16 crc16ModbusFinal(const UINT16 ui16_crc)
+{
+	return (ui16_crc);
+}
+/*!
+ * \fn crc16Modbus(const BYTE *pc_ptr, const UINT32 ui32_length)
+ * \brief calculate CRC-16/MODBUS of buffer
+ * \param pc_ptr buffer pointer
+ * \param ui32_length number of bytes of buffer to process
+ * \return CRC of buffer, 0 if buffer ends with its valid CRC
+ */
+static inline UINT16 crc16Modbus(const BYTE *pc_ptr, const UINT32 ui32_length)
+{
+	return (crc16ModbusFinal(crc16ModbusUpdate(crc16ModbusInit(), pc_ptr, ui32_length)));
+}
+
+/*!
+ * \fn crc32Init
+ * \brief start CRC-32 computation
+ * \return initial CRC
+ */
+static inline UINT32 crc32Init(void)
+{
+	return (CRC32_INIT);
+}
+/*!
+ * \fn crc32Final(const UINT32 ui32_crc)
+ * \brief finish CRC-32 computation
+ * \param ui32_crc updated CRC
+ * \return CRC of data
+ */
+static inline UINT32 crc32Final(const UINT32 ui32_crc)
+{
+	return (ui32_crc ^ 0xFFFFFFFFUL);
+}
+/*!
+ * \fn crc32(const BYTE *pc_ptr, const UINT32 ui32_length)
+ * \brief calculate CRC-32 of buffer
+ * \param pc_ptr buffer pointer
+ * \param ui32_length number of bytes of buffer to process
+ * \return CRC of buffer
+ */
+static inline UINT32 crc32(const BYTE *pc_ptr, const UINT32 ui32_length)
+{
+	return (crc32Final(crc32Update(crc32Init(), pc_ptr, ui32_length)));
+}
+
+#endif // _CRC_H
+
+// END
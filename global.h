@@ -83,6 +83,11 @@ typedef int16_t INT16;
  * \brief INT32 type - signed integer, 32-bit
  */
 typedef int32_t INT32;
+/*!
+ * \typedef INT64
+ * \brief INT64 type - signed integer, 64-bit
+ */
+typedef int64_t INT64;
 
 /*!
  * \typedef UINT8
@@ -99,6 +104,11 @@ typedef uint16_t UINT16;
  * \brief UINT32 type - unsigned integer, 32-bit
  */
 typedef uint32_t UINT32;
+/*!
+ * \typedef UINT64
+ * \brief UINT64 type - unsigned integer, 64-bit
+ */
+typedef uint64_t UINT64;
 
 /*!
  * \typedef _WORD
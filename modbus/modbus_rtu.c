@@ -0,0 +1,505 @@
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+/*!
+ * \file modbus_rtu.c
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief Non-blocking Modbus RTU master/slave engine - implementation.
+ * \note
+ * For detailed description see header file.
+ */
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#include "ehal/modbus/modbus_rtu.h"
+#include "ehal/chksum/crc.h"
+#include "ehal/rs4xx/rs4xx.h"
+#include "ehal/sync_timer/sync_timer.h"
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+// definitions check
+#ifndef USART_RX_FRAMES
+	#error "MODBUS: USART_RX_FRAMES is not set!"
+#endif // USART_RX_FRAMES
+
+#ifndef SYNC_TIMER_JIFFIES
+	#error "MODBUS: SYNC_TIMER_JIFFIES is not set!"
+#endif // SYNC_TIMER_JIFFIES
+
+#if ((MODBUS_RTU_ADU_MAX < 8) || (MODBUS_RTU_ADU_MAX > 256))
+	#error "MODBUS: MODBUS_RTU_ADU_MAX out of range (8..256)"
+#endif
+
+#if (USART_SEND_MAX_LENGTH < MODBUS_RTU_ADU_MAX)
+	#error "MODBUS: USART_SEND_MAX_LENGTH lower than MODBUS_RTU_ADU_MAX"
+#endif
+
+// whole frame is parsed in place in rx ring
+#if (USART_RBUF_SIZE < MODBUS_RTU_ADU_MAX)
+	#error "MODBUS: USART_RBUF_SIZE lower than MODBUS_RTU_ADU_MAX"
+#endif
+
+// whole frame is queued at once, sending never waits for transmitter to drain tx ring
+#if (USART_TBUF_SIZE < MODBUS_RTU_ADU_MAX)
+	#error "MODBUS: USART_TBUF_SIZE lower than MODBUS_RTU_ADU_MAX"
+#endif
+
+// address, function code and crc
+#define MODBUS_RTU_FRAME_MIN 4
+#define MODBUS_RTU_EXCEPTION_FLAG 0x80
+
+#define MODBUS_RTU_READ_MAX 125
+#define MODBUS_RTU_WRITE_MAX 123
+
+// function code handler, builds response in ac_tx and returns exception code
+typedef UINT8 (*modbus_rtu_fc_fnc_t)(modbus_rtu_st *mb, const ring_span_st *frame, UINT16 *pui16_length);
+
+typedef struct
+{
+	UINT8 ui8_function;
+	modbus_rtu_fc_fnc_t handler;
+} modbus_rtu_fc_st;
+
+// static functions
+static UINT16 modbus_rtu_crcFrame(const ring_st *ring, const ring_span_st *frame);
+static UINT8 modbus_rtu_byte(const modbus_rtu_st *mb, const ring_span_st *frame, const UINT16 ui16_offset);
+static UINT16 modbus_rtu_word(const modbus_rtu_st *mb, const ring_span_st *frame, const UINT16 ui16_offset);
+static VOID modbus_rtu_putWord(BYTE *pc_dst, const UINT16 ui16_val);
+static VOID modbus_rtu_send(modbus_rtu_st *mb, const UINT16 ui16_length);
+
+static UINT16 *modbus_rtu_findRegs(const modbus_rtu_st *mb, const e_modbus_regtype_t type, const UINT16 ui16_address, const UINT16 ui16_count);
+static UINT8 modbus_rtu_fcRead(modbus_rtu_st *mb, const ring_span_st *frame, UINT16 *pui16_length);
+static UINT8 modbus_rtu_fcWriteSingle(modbus_rtu_st *mb, const ring_span_st *frame, UINT16 *pui16_length);
+static UINT8 modbus_rtu_fcWriteMultiple(modbus_rtu_st *mb, const ring_span_st *frame, UINT16 *pui16_length);
+static VOID modbus_rtu_slaveFrame(modbus_rtu_st *mb, const ring_span_st *frame);
+
+static VOID modbus_rtu_masterDone(modbus_rtu_st *mb, const e_modbus_status_t status, const UINT8 ui8_exception);
+static VOID modbus_rtu_masterFrame(modbus_rtu_st *mb, const ring_span_st *frame);
+static VOID modbus_rtu_masterNext(modbus_rtu_st *mb);
+static VOID modbus_rtu_masterRequest(modbus_rtu_st *mb, modbus_poll_st *poll);
+
+// slave function code dispatch table
+static const modbus_rtu_fc_st modbus_rtu_functions[] = {
+	{MODBUS_FC_READ_HOLDING_REGISTERS, modbus_rtu_fcRead},
+	{MODBUS_FC_READ_INPUT_REGISTERS, modbus_rtu_fcRead},
+	{MODBUS_FC_WRITE_SINGLE_REGISTER, modbus_rtu_fcWriteSingle},
+	{MODBUS_FC_WRITE_MULTIPLE_REGISTERS, modbus_rtu_fcWriteMultiple}
+};
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+// --------------------------------------------------------------------------
+VOID modbusRtuInit(modbus_rtu_st *mb, usart_cfg_st *usart, const UINT16 ui16_silence_bits)
+{
+	mb->usart = usart;
+	mb->b_master = false;
+
+	mb->ui8_address = MODBUS_RTU_BROADCAST;
+	mb->regmaps = NULL;
+	mb->ui8_regmaps = 0;
+	mb->write_cb = NULL;
+
+	mb->polls = NULL;
+	mb->ui8_polls = 0;
+	mb->ui8_poll_current = 0;
+	mb->b_waiting = false;
+
+	usartRxFramingEnable(usart, ui16_silence_bits);
+}
+
+// --------------------------------------------------------------------------
+VOID modbusRtuMaster(modbus_rtu_st *mb, modbus_poll_st *polls, const UINT8 ui8_count, const UINT16 ui16_timeout_ms)
+{
+	mb->b_master = true;
+	mb->polls = polls;
+	mb->ui8_polls = ui8_count;
+	mb->ui16_timeout_ms = ui16_timeout_ms;
+	mb->b_waiting = false;
+
+	// all requests are due immediately, start with the first one
+	for (UINT8 i = 0; i < ui8_count; ++i)
+	{
+		polls[i].status = MODBUS_STATUS_NONE;
+		polls[i].ui8_exception = MODBUS_EXC_NONE;
+		polls[i].ui32_next = jiffies;
+	}
+	mb->ui8_poll_current = ui8_count - 1;
+}
+
+// --------------------------------------------------------------------------
+VOID modbusRtuPoll(modbus_rtu_st *mb)
+{
+	ring_span_st frame;
+
+	// parse frames in place, drop corrupted ones
+	while (usartRxFrameGet(mb->usart, &frame))
+	{
+		if ((frame.length >= MODBUS_RTU_FRAME_MIN) && !modbus_rtu_crcFrame(&mb->usart->usart_rx_ring, &frame))
+		{
+			if (mb->b_master)
+				modbus_rtu_masterFrame(mb, &frame);
+			else
+				modbus_rtu_slaveFrame(mb, &frame);
+		}
+		usartRxConsume(mb->usart, frame.length);
+	}
+
+	if (!mb->b_master || !mb->ui8_polls)
+		return;
+
+	// broadcast is never answered, its timeout gives slaves time to process it
+	if (mb->b_waiting && TIME_AFTER_EQ(jiffies, mb->ui32_deadline))
+	{
+		if (MODBUS_RTU_BROADCAST == mb->polls[mb->ui8_poll_current].ui8_slave)
+			modbus_rtu_masterDone(mb, MODBUS_STATUS_OK, MODBUS_EXC_NONE);
+		else
+			modbus_rtu_masterDone(mb, MODBUS_STATUS_TIMEOUT, MODBUS_EXC_NONE);
+	}
+
+	if (!mb->b_waiting)
+		modbus_rtu_masterNext(mb);
+}
+
+// --------------------------------------------------------------------------
+VOID modbusRtuSlave(modbus_rtu_st *mb, const UINT8 ui8_address, const modbus_regmap_st *regmaps, const UINT8 ui8_count, const modbus_write_cb_t cb)
+{
+	mb->b_master = false;
+	mb->ui8_address = ui8_address;
+	mb->regmaps = regmaps;
+	mb->ui8_regmaps = ui8_count;
+	mb->write_cb = cb;
+}
+
+// static functions
+// --------------------------------------------------------------------------
+static UINT16 modbus_rtu_crcFrame(const ring_st *ring, const ring_span_st *frame)
+{
+	ring_size_t start = frame->start & ring->mask;
+	UINT16 ui16_first = ring->mask + 1 - start;
+
+	// frame wrapping around the end of ring buffer is processed in two contiguous parts
+	if (ui16_first > frame->length)
+		ui16_first = frame->length;
+
+	// crc over whole frame including transmitted crc gives 0
+	return (crc16ModbusUpdate(crc16ModbusUpdate(crc16ModbusInit(), ring->pc_buff + start, ui16_first), ring->pc_buff, frame->length - ui16_first));
+}
+
+// --------------------------------------------------------------------------
+static UINT8 modbus_rtu_byte(const modbus_rtu_st *mb, const ring_span_st *frame, const UINT16 ui16_offset)
+{
+	return (ringAt(&mb->usart->usart_rx_ring, frame->start + ui16_offset));
+}
+
+// --------------------------------------------------------------------------
+static UINT16 modbus_rtu_word(const modbus_rtu_st *mb, const ring_span_st *frame, const UINT16 ui16_offset)
+{
+	return (((UINT16)modbus_rtu_byte(mb, frame, ui16_offset) << 8) | modbus_rtu_byte(mb, frame, ui16_offset + 1));
+}
+
+// --------------------------------------------------------------------------
+static VOID modbus_rtu_putWord(BYTE *pc_dst, const UINT16 ui16_val)
+{
+	pc_dst[0] = ui16_val >> 8;
+	pc_dst[1] = ui16_val & 0xFF;
+}
+
+// --------------------------------------------------------------------------
+static VOID modbus_rtu_send(modbus_rtu_st *mb, const UINT16 ui16_length)
+{
+	UINT16 ui16_crc = crc16Modbus(mb->ac_tx, ui16_length);
+
+	// crc is transmitted low byte first
+	mb->ac_tx[ui16_length] = ui16_crc & 0xFF;
+	mb->ac_tx[ui16_length + 1] = ui16_crc >> 8;
+
+	rs4xxSend(mb->usart, mb->ac_tx, ui16_length + 2);
+}
+
+// --------------------------------------------------------------------------
+static UINT16 *modbus_rtu_findRegs(const modbus_rtu_st *mb, const e_modbus_regtype_t type, const UINT16 ui16_address, const UINT16 ui16_count)
+{
+	const modbus_regmap_st *map;
+
+	for (UINT8 i = 0; i < mb->ui8_regmaps; ++i)
+	{
+		map = &mb->regmaps[i];
+		if ((map->type != type) || (ui16_address < map->ui16_start))
+			continue;
+		if (((UINT32)ui16_address + ui16_count) > ((UINT32)map->ui16_start + map->ui16_count))
+			continue;
+
+		return (map->pui16_regs + (ui16_address - map->ui16_start));
+	}
+
+	return (NULL);
+}
+
+// --------------------------------------------------------------------------
+static UINT8 modbus_rtu_fcRead(modbus_rtu_st *mb, const ring_span_st *frame, UINT16 *pui16_length)
+{
+	e_modbus_regtype_t type;
+	UINT16 ui16_count;
+	UINT16 *pui16_regs;
+
+	if (frame->length != 8)
+		return (MODBUS_EXC_ILLEGAL_DATA_VALUE);
+
+	type = (MODBUS_FC_READ_HOLDING_REGISTERS == modbus_rtu_byte(mb, frame, 1))?(MODBUS_REG_HOLDING):(MODBUS_REG_INPUT);
+	ui16_count = modbus_rtu_word(mb, frame, 4);
+	if (!ui16_count || (ui16_count > MODBUS_RTU_READ_MAX) || ((5 + 2 * ui16_count) > MODBUS_RTU_ADU_MAX))
+		return (MODBUS_EXC_ILLEGAL_DATA_VALUE);
+
+	pui16_regs = modbus_rtu_findRegs(mb, type, modbus_rtu_word(mb, frame, 2), ui16_count);
+	if (!pui16_regs)
+		return (MODBUS_EXC_ILLEGAL_DATA_ADDRESS);
+
+	mb->ac_tx[2] = 2 * ui16_count;
+	for (UINT16 i = 0; i < ui16_count; ++i)
+		modbus_rtu_putWord(&mb->ac_tx[3 + 2 * i], pui16_regs[i]);
+	*pui16_length = 3 + 2 * ui16_count;
+
+	return (MODBUS_EXC_NONE);
+}
+
+// --------------------------------------------------------------------------
+static UINT8 modbus_rtu_fcWriteSingle(modbus_rtu_st *mb, const ring_span_st *frame, UINT16 *pui16_length)
+{
+	UINT16 ui16_address;
+	UINT16 *pui16_regs;
+
+	if (frame->length != 8)
+		return (MODBUS_EXC_ILLEGAL_DATA_VALUE);
+
+	ui16_address = modbus_rtu_word(mb, frame, 2);
+	pui16_regs = modbus_rtu_findRegs(mb, MODBUS_REG_HOLDING, ui16_address, 1);
+	if (!pui16_regs)
+		return (MODBUS_EXC_ILLEGAL_DATA_ADDRESS);
+
+	*pui16_regs = modbus_rtu_word(mb, frame, 4);
+	if (mb->write_cb)
+		mb->write_cb(ui16_address, 1);
+
+	// response echoes the request
+	for (UINT8 i = 2; i < 6; ++i)
+		mb->ac_tx[i] = modbus_rtu_byte(mb, frame, i);
+	*pui16_length = 6;
+
+	return (MODBUS_EXC_NONE);
+}
+
+// --------------------------------------------------------------------------
+static UINT8 modbus_rtu_fcWriteMultiple(modbus_rtu_st *mb, const ring_span_st *frame, UINT16 *pui16_length)
+{
+	UINT16 ui16_address, ui16_count;
+	UINT16 *pui16_regs;
+
+	if (frame->length < 11)
+		return (MODBUS_EXC_ILLEGAL_DATA_VALUE);
+
+	ui16_address = modbus_rtu_word(mb, frame, 2);
+	ui16_count = modbus_rtu_word(mb, frame, 4);
+	if (!ui16_count || (ui16_count > MODBUS_RTU_WRITE_MAX) || (modbus_rtu_byte(mb, frame, 6) != 2 * ui16_count)
+		|| (frame->length != 9 + 2 * ui16_count))
+		return (MODBUS_EXC_ILLEGAL_DATA_VALUE);
+
+	pui16_regs = modbus_rtu_findRegs(mb, MODBUS_REG_HOLDING, ui16_address, ui16_count);
+	if (!pui16_regs)
+		return (MODBUS_EXC_ILLEGAL_DATA_ADDRESS);
+
+	for (UINT16 i = 0; i < ui16_count; ++i)
+		pui16_regs[i] = modbus_rtu_word(mb, frame, 7 + 2 * i);
+	if (mb->write_cb)
+		mb->write_cb(ui16_address, ui16_count);
+
+	modbus_rtu_putWord(&mb->ac_tx[2], ui16_address);
+	modbus_rtu_putWord(&mb->ac_tx[4], ui16_count);
+	*pui16_length = 6;
+
+	return (MODBUS_EXC_NONE);
+}
+
+// --------------------------------------------------------------------------
+static VOID modbus_rtu_slaveFrame(modbus_rtu_st *mb, const ring_span_st *frame)
+{
+	UINT8 ui8_address = modbus_rtu_byte(mb, frame, 0);
+	UINT8 ui8_function = modbus_rtu_byte(mb, frame, 1);
+	UINT8 ui8_exception = MODBUS_EXC_ILLEGAL_FUNCTION;
+	UINT16 ui16_length = 0;
+
+	if ((ui8_address != mb->ui8_address) && (ui8_address != MODBUS_RTU_BROADCAST))
+		return;
+
+	for (UINT8 i = 0; i < (sizeof(modbus_rtu_functions) / sizeof(modbus_rtu_functions[0])); ++i)
+	{
+		if (modbus_rtu_functions[i].ui8_function == ui8_function)
+		{
+			ui8_exception = modbus_rtu_functions[i].handler(mb, frame, &ui16_length);
+			break;
+		}
+	}
+
+	// broadcast requests are never answered
+	if (MODBUS_RTU_BROADCAST == ui8_address)
+		return;
+
+	mb->ac_tx[0] = mb->ui8_address;
+	mb->ac_tx[1] = ui8_function;
+	if (ui8_exception)
+	{
+		mb->ac_tx[1] |= MODBUS_RTU_EXCEPTION_FLAG;
+		mb->ac_tx[2] = ui8_exception;
+		ui16_length = 3;
+	}
+
+	modbus_rtu_send(mb, ui16_length);
+}
+
+// --------------------------------------------------------------------------
+static VOID modbus_rtu_masterDone(modbus_rtu_st *mb, const e_modbus_status_t status, const UINT8 ui8_exception)
+{
+	modbus_poll_st *poll = &mb->polls[mb->ui8_poll_current];
+
+	poll->status = status;
+	poll->ui8_exception = ui8_exception;
+	mb->b_waiting = false;
+}
+
+// --------------------------------------------------------------------------
+static VOID modbus_rtu_masterFrame(modbus_rtu_st *mb, const ring_span_st *frame)
+{
+	modbus_poll_st *poll = &mb->polls[mb->ui8_poll_current];
+	UINT8 ui8_function = modbus_rtu_byte(mb, frame, 1);
+
+	// unsolicited frame or response of other slave
+	if (!mb->b_waiting || (modbus_rtu_byte(mb, frame, 0) != poll->ui8_slave))
+		return;
+
+	if (ui8_function == (poll->ui8_function | MODBUS_RTU_EXCEPTION_FLAG))
+	{
+		modbus_rtu_masterDone(mb, MODBUS_STATUS_EXCEPTION, (frame->length == 5)?(modbus_rtu_byte(mb, frame, 2)):(MODBUS_EXC_NONE));
+		return;
+	}
+
+	if (ui8_function != poll->ui8_function)
+	{
+		modbus_rtu_masterDone(mb, MODBUS_STATUS_ERROR, MODBUS_EXC_NONE);
+		return;
+	}
+
+	switch (ui8_function)
+	{
+		case MODBUS_FC_READ_HOLDING_REGISTERS:
+		case MODBUS_FC_READ_INPUT_REGISTERS:
+			if ((frame->length != 5 + 2 * poll->ui16_count) || (modbus_rtu_byte(mb, frame, 2) != 2 * poll->ui16_count))
+			{
+				modbus_rtu_masterDone(mb, MODBUS_STATUS_ERROR, MODBUS_EXC_NONE);
+				return;
+			}
+			// registers are taken straight from rx ring
+			for (UINT16 i = 0; i < poll->ui16_count; ++i)
+				poll->pui16_data[i] = modbus_rtu_word(mb, frame, 3 + 2 * i);
+			break;
+
+		default:
+			if (frame->length != 8)
+			{
+				modbus_rtu_masterDone(mb, MODBUS_STATUS_ERROR, MODBUS_EXC_NONE);
+				return;
+			}
+			break;
+	}
+
+	modbus_rtu_masterDone(mb, MODBUS_STATUS_OK, MODBUS_EXC_NONE);
+}
+
+// --------------------------------------------------------------------------
+static VOID modbus_rtu_masterNext(modbus_rtu_st *mb)
+{
+	UINT8 ui8_index;
+
+	// round robin over requests that are due
+	for (UINT8 i = 1; i <= mb->ui8_polls; ++i)
+	{
+		ui8_index = (mb->ui8_poll_current + i) % mb->ui8_polls;
+		if (TIME_BEFORE(jiffies, mb->polls[ui8_index].ui32_next))
+			continue;
+
+		mb->ui8_poll_current = ui8_index;
+		modbus_rtu_masterRequest(mb, &mb->polls[ui8_index]);
+		return;
+	}
+}
+
+// --------------------------------------------------------------------------
+static VOID modbus_rtu_masterRequest(modbus_rtu_st *mb, modbus_poll_st *poll)
+{
+	UINT16 ui16_length;
+
+	poll->ui32_next = jiffies + poll->ui16_period_ms;
+
+	mb->ac_tx[0] = poll->ui8_slave;
+	mb->ac_tx[1] = poll->ui8_function;
+	modbus_rtu_putWord(&mb->ac_tx[2], poll->ui16_address);
+
+	switch (poll->ui8_function)
+	{
+		case MODBUS_FC_READ_HOLDING_REGISTERS:
+		case MODBUS_FC_READ_INPUT_REGISTERS:
+			if (!poll->ui16_count || (poll->ui16_count > MODBUS_RTU_READ_MAX) || ((5 + 2 * poll->ui16_count) > MODBUS_RTU_ADU_MAX))
+			{
+				modbus_rtu_masterDone(mb, MODBUS_STATUS_ERROR, MODBUS_EXC_NONE);
+				return;
+			}
+			modbus_rtu_putWord(&mb->ac_tx[4], poll->ui16_count);
+			ui16_length = 6;
+			break;
+
+		case MODBUS_FC_WRITE_SINGLE_REGISTER:
+			modbus_rtu_putWord(&mb->ac_tx[4], poll->pui16_data[0]);
+			ui16_length = 6;
+			break;
+
+		case MODBUS_FC_WRITE_MULTIPLE_REGISTERS:
+			if (!poll->ui16_count || (poll->ui16_count > MODBUS_RTU_WRITE_MAX) || ((9 + 2 * poll->ui16_count) > MODBUS_RTU_ADU_MAX))
+			{
+				modbus_rtu_masterDone(mb, MODBUS_STATUS_ERROR, MODBUS_EXC_NONE);
+				return;
+			}
+			modbus_rtu_putWord(&mb->ac_tx[4], poll->ui16_count);
+			mb->ac_tx[6] = 2 * poll->ui16_count;
+			for (UINT16 i = 0; i < poll->ui16_count; ++i)
+				modbus_rtu_putWord(&mb->ac_tx[7 + 2 * i], poll->pui16_data[i]);
+			ui16_length = 7 + 2 * poll->ui16_count;
+			break;
+
+		default:
+			modbus_rtu_masterDone(mb, MODBUS_STATUS_ERROR, MODBUS_EXC_ILLEGAL_FUNCTION);
+			return;
+	}
+
+	mb->b_waiting = true;
+	mb->ui32_deadline = jiffies + mb->ui16_timeout_ms;
+	modbus_rtu_send(mb, ui16_length);
+}
+
+// END
@@ -0,0 +1,222 @@
+/*!
+ * \file modbus_rtu.h
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief Non-blocking Modbus RTU master/slave engine - definitions
+ * \details
+ * Modbus RTU over RS422/485 (rs4xx) and buffered usart. Frames are delimited by line silence detected
+ * with usart idle line framing (USART_RX_FRAMES) and parsed in place in usart rx ring, no copy of received
+ * frame is made. Function codes are dispatched through a table, CRC is computed with crc16Modbus() (see crc.h).
+ *
+ * Slave mode answers read/write requests from register maps given by application.
+ * Master mode polls table of requests to many slaves, next request is issued as soon as response or timeout
+ * of previous one is handled.
+ *
+ * Supported function codes: 0x03, 0x04, 0x06, 0x10.
+ *
+ * This library needs following definitions to be set in config.h:
+ * - USART_RX_FRAMES - usart idle line framing
+ * - SYNC_TIMER_JIFFIES - jiffies for master response timeouts and polling periods
+ * Optional:
+ * - MODBUS_RTU_ADU_MAX - size of transmit buffer, max frame length (default 256)
+ *
+ * Usart rx and tx rings (USART_RBUF_SIZE, USART_TBUF_SIZE) have to hold MODBUS_RTU_ADU_MAX bytes, so received
+ * frame is parsed in place and frame being sent is queued at once without waiting for transmitter.
+ *
+ * \note
+ * modbusRtuPoll() has to be invoked frequently, e.g. in main loop. Received frames have to be consumed only by
+ * the engine.
+ */
+
+#ifndef _MODBUS_RTU_H
+#define _MODBUS_RTU_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#include "config.h"
+#include "ehal/global.h"
+#include "ehal/usart/usart.h"
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+#ifndef MODBUS_RTU_ADU_MAX
+#define MODBUS_RTU_ADU_MAX 256
+#endif // MODBUS_RTU_ADU_MAX
+
+/*!
+ * \def MODBUS_RTU_SILENCE_BITS
+ * \brief 3.5 character silence for 11-bit RTU characters, in bit times
+ */
+#define MODBUS_RTU_SILENCE_BITS 39
+
+/*!
+ * \def MODBUS_RTU_BROADCAST
+ * \brief broadcast slave address
+ */
+#define MODBUS_RTU_BROADCAST 0x00
+
+// function codes
+#define MODBUS_FC_READ_HOLDING_REGISTERS   0x03
+#define MODBUS_FC_READ_INPUT_REGISTERS     0x04
+#define MODBUS_FC_WRITE_SINGLE_REGISTER    0x06
+#define MODBUS_FC_WRITE_MULTIPLE_REGISTERS 0x10
+
+// exception codes
+#define MODBUS_EXC_NONE                 0x00
+#define MODBUS_EXC_ILLEGAL_FUNCTION     0x01
+#define MODBUS_EXC_ILLEGAL_DATA_ADDRESS 0x02
+#define MODBUS_EXC_ILLEGAL_DATA_VALUE   0x03
+
+/*!
+ * \enum e_modbus_regtype
+ * \brief register table type
+ */
+enum e_modbus_regtype
+{
+	MODBUS_REG_HOLDING = 0,
+	MODBUS_REG_INPUT
+};
+/*!
+ * \typedef e_modbus_regtype_t
+ * \brief register table type
+ */
+typedef enum e_modbus_regtype e_modbus_regtype_t;
+
+/*!
+ * \enum e_modbus_status
+ * \brief master request status
+ */
+enum e_modbus_status
+{
+	MODBUS_STATUS_NONE = 0,
+	MODBUS_STATUS_OK,
+	MODBUS_STATUS_TIMEOUT,
+	MODBUS_STATUS_EXCEPTION,
+	MODBUS_STATUS_ERROR
+};
+/*!
+ * \typedef e_modbus_status_t
+ * \brief master request status
+ */
+typedef enum e_modbus_status e_modbus_status_t;
+
+/*!
+ * \typedef modbus_write_cb_t
+ * \brief slave callback executed after registers were written by master
+ */
+typedef VOID (*modbus_write_cb_t)(const UINT16 ui16_address, const UINT16 ui16_count);
+
+/*!
+ * \struct modbus_regmap_st
+ * \brief slave register table
+ */
+typedef struct
+{
+	e_modbus_regtype_t type;
+	UINT16 ui16_start;
+	UINT16 ui16_count;
+	UINT16 *pui16_regs;
+} modbus_regmap_st;
+
+/*!
+ * \struct modbus_poll_st
+ * \brief master request, read registers are stored to/written registers are taken from pui16_data
+ */
+typedef struct
+{
+	UINT8 ui8_slave;
+	UINT8 ui8_function;
+	UINT16 ui16_address;
+	UINT16 ui16_count;
+	UINT16 *pui16_data;
+	UINT16 ui16_period_ms;
+
+	// result of latest request
+	e_modbus_status_t status;
+	UINT8 ui8_exception;
+
+	// used internally
+	UINT32 ui32_next;
+} modbus_poll_st;
+
+/*!
+ * \struct modbus_rtu_st
+ * \brief engine instance
+ */
+typedef struct
+{
+	usart_cfg_st *usart;
+	BOOL b_master;
+
+	// slave
+	UINT8 ui8_address;
+	const modbus_regmap_st *regmaps;
+	UINT8 ui8_regmaps;
+	modbus_write_cb_t write_cb;
+
+	// master
+	modbus_poll_st *polls;
+	UINT8 ui8_polls;
+	UINT8 ui8_poll_current;
+	BOOL b_waiting;
+	UINT16 ui16_timeout_ms;
+	UINT32 ui32_deadline;
+
+	BYTE ac_tx[MODBUS_RTU_ADU_MAX];
+} modbus_rtu_st;
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+/*!
+ * \fn modbusRtuInit(modbus_rtu_st *mb, usart_cfg_st *usart, const UINT16 ui16_silence_bits)
+ * \brief initialize engine on given usart and enable silence based framing
+ * \param mb engine instance
+ * \param usart initialized usart connected to RS422/485 transceiver
+ * \param ui16_silence_bits inter-frame silence in bit times (MODBUS_RTU_SILENCE_BITS, or less for fixed 1.75ms above 19200bd)
+ */
+VOID modbusRtuInit(modbus_rtu_st *mb, usart_cfg_st *usart, const UINT16 ui16_silence_bits);
+/*!
+ * \fn modbusRtuMaster(modbus_rtu_st *mb, modbus_poll_st *polls, const UINT8 ui8_count, const UINT16 ui16_timeout_ms)
+ * \brief select master mode
+ * \param polls table of requests issued in turn according to their periods
+ * \param ui8_count number of requests
+ * \param ui16_timeout_ms response timeout counted from request start
+ */
+VOID modbusRtuMaster(modbus_rtu_st *mb, modbus_poll_st *polls, const UINT8 ui8_count, const UINT16 ui16_timeout_ms);
+/*!
+ * \fn modbusRtuPoll(modbus_rtu_st *mb)
+ * \brief handle received frames, timeouts and issue master requests, never blocks
+ */
+VOID modbusRtuPoll(modbus_rtu_st *mb);
+/*!
+ * \fn modbusRtuSlave(modbus_rtu_st *mb, const UINT8 ui8_address, const modbus_regmap_st *regmaps, const UINT8 ui8_count, const modbus_write_cb_t cb)
+ * \brief select slave mode
+ * \param ui8_address slave address
+ * \param regmaps register tables
+ * \param ui8_count number of register tables
+ * \param cb callback executed after holding registers were written, may be NULL
+ */
+VOID modbusRtuSlave(modbus_rtu_st *mb, const UINT8 ui8_address, const modbus_regmap_st *regmaps, const UINT8 ui8_count, const modbus_write_cb_t cb);
+
+#ifdef __cplusplus
+}
+#endif // extern "C"
+
+#endif // _MODBUS_RTU_H
+
+// END
@@ -59,6 +59,11 @@ static BOOL b_is_p_variant;
 static BOOL b_dynamic_payloads;
 static UINT8 addr_width;
 static e_nrf24_mode_t curr_mode;
+#ifdef SYNC_TIMER_US
+// transceiver is settling after mode change until given timestamp
+static BOOL b_settling;
+static UINT32 ui32_settled_us;
+#endif // SYNC_TIMER_US
 
 // static functions
 static void nrf24_readRegister(UINT8 reg, BYTE *data, UINT8 len);
@@ -76,6 +81,9 @@ static BOOL nrf24_modePowerDown(void);
 static BOOL nrf24_modeStandBy(void);
 static BOOL nrf24_modeRx(void);
 static BOOL nrf24_modeTx(void);
+#ifdef SYNC_TIMER_US
+static void nrf24_waitSettled(void);
+#endif // SYNC_TIMER_US
 
 static setmode_fnc_t mode_func_array[] = {
 	nrf24_modePowerDown,
@@ -546,7 +554,7 @@ UINT8 nrf24Receive(BYTE *buffer, UINT8 len, UINT8 *pipe_num, UINT16 timeout_ms)
 			break;
 		}
 	}
-	while (jiffies < end_time);
+	while (TIME_BEFORE(jiffies, end_time));
 
 	return (received_len);
 }
@@ -561,6 +569,9 @@ UINT8 nrf24Send(BYTE* buffer, UINT8 len, BOOL ack, BOOL listen)
 	nrf24SetMode(NRF24_MODE_TX);
 	len = nrf24_writePayload(buffer, len, ack);
 
+#ifdef SYNC_TIMER_US
+	nrf24_waitSettled();
+#endif // SYNC_TIMER_US
 	NRF24_CE_HIGH();
 	while (1)
 	{
@@ -755,7 +766,13 @@ static BOOL nrf24_modeRx(void)
 		config.PRIM_RX = 1;
 		if (!nrf24_writeByteRegister(NRF24_REG_CONFIG, (BYTE*)&config))
 			return (false);
+#ifdef SYNC_TIMER_US
+		// settling time is overlapped with caller's work, see nrf24_waitSettled()
+		ui32_settled_us = syncTimerNowUs() + NRF24_WAKEUP_TIME_US;
+		b_settling = true;
+#else
 		delayUs(NRF24_WAKEUP_TIME_US);
+#endif // SYNC_TIMER_US
 	}
 
 	curr_mode = NRF24_MODE_RX;
@@ -780,7 +797,13 @@ static BOOL nrf24_modeTx(void)
 		config.PRIM_RX = 0;
 		if (!nrf24_writeByteRegister(NRF24_REG_CONFIG, (BYTE*)&config))
 			return (false);
+#ifdef SYNC_TIMER_US
+		// settling time is overlapped with caller's work, see nrf24_waitSettled()
+		ui32_settled_us = syncTimerNowUs() + NRF24_WAKEUP_TIME_US;
+		b_settling = true;
+#else
 		delayUs(NRF24_WAKEUP_TIME_US);
+#endif // SYNC_TIMER_US
 	}
 
 	NRF24_CE_LOW();
@@ -789,6 +812,19 @@ static BOOL nrf24_modeTx(void)
 	return (true);
 }
 
+#ifdef SYNC_TIMER_US
+// --------------------------------------------------------------------------
+static void nrf24_waitSettled(void)
+{
+	// payload upload usually takes most of settling time, only the rest is waited
+	if (b_settling)
+	{
+		syncTimerDelayUntilUs(ui32_settled_us);
+		b_settling = false;
+	}
+}
+#endif // SYNC_TIMER_US
+
 // --------------------------------------------------------------------------
 static UINT8 nrf24_getRxPayloadLength(void)
 {
@@ -0,0 +1,121 @@
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+/*!
+ * \file ring.c
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief Lock-free single producer / single consumer byte ring buffer - implementation.
+ * \note
+ * For detailed description see header file.
+ */
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#include "ehal/ring/ring.h"
+
+#include <string.h>
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+// --------------------------------------------------------------------------
+VOID ringConsume(ring_st *ring, const UINT16 ui16_length)
+{
+	ring_size_t tail = ring->tail;
+	UINT16 ui16_used = (ring_size_t)(ring->head - tail);
+
+	RING_BARRIER();
+	ring->tail = tail + ((ui16_length < ui16_used)?(ui16_length):(ui16_used));
+}
+
+// --------------------------------------------------------------------------
+VOID ringInit(ring_st *ring, BYTE *pc_buff, const UINT16 ui16_size)
+{
+	ring->pc_buff = pc_buff;
+	ring->mask = (ring_size_t)(ui16_size - 1);
+	ring->head = 0;
+	ring->tail = 0;
+}
+
+// --------------------------------------------------------------------------
+UINT16 ringPeek(const ring_st *ring, BYTE **ppc_data)
+{
+	ring_size_t tail = ring->tail;
+	UINT16 ui16_used = (ring_size_t)(ring->head - tail);
+	UINT16 ui16_pos = tail & ring->mask;
+	UINT16 ui16_contiguous = ringSize(ring) - ui16_pos;
+
+	RING_BARRIER();
+	*ppc_data = ring->pc_buff + ui16_pos;
+
+	return ((ui16_used < ui16_contiguous)?(ui16_used):(ui16_contiguous));
+}
+
+// --------------------------------------------------------------------------
+UINT16 ringRead(ring_st *ring, BYTE *pc_dst, const UINT16 ui16_length)
+{
+	ring_size_t tail = ring->tail;
+	UINT16 ui16_used = (ring_size_t)(ring->head - tail);
+	UINT16 ui16_pos = tail & ring->mask;
+	UINT16 ui16_count, ui16_first;
+
+	ui16_count = (ui16_length < ui16_used)?(ui16_length):(ui16_used);
+	if (!ui16_count)
+		return (0);
+
+	// copy in at most two segments: up to end of storage and from its beginning
+	ui16_first = ringSize(ring) - ui16_pos;
+	if (ui16_first > ui16_count)
+		ui16_first = ui16_count;
+
+	RING_BARRIER();
+	memcpy(pc_dst, ring->pc_buff + ui16_pos, ui16_first);
+	memcpy(pc_dst + ui16_first, ring->pc_buff, ui16_count - ui16_first);
+	RING_BARRIER();
+
+	ring->tail = tail + ui16_count;
+
+	return (ui16_count);
+}
+
+// --------------------------------------------------------------------------
+UINT16 ringWrite(ring_st *ring, const BYTE *pc_src, const UINT16 ui16_length)
+{
+	ring_size_t head = ring->head;
+	UINT16 ui16_free = ringSize(ring) - (ring_size_t)(head - ring->tail);
+	UINT16 ui16_pos = head & ring->mask;
+	UINT16 ui16_count, ui16_first;
+
+	ui16_count = (ui16_length < ui16_free)?(ui16_length):(ui16_free);
+	if (!ui16_count)
+		return (0);
+
+	// copy in at most two segments: up to end of storage and from its beginning
+	ui16_first = ringSize(ring) - ui16_pos;
+	if (ui16_first > ui16_count)
+		ui16_first = ui16_count;
+
+	memcpy(ring->pc_buff + ui16_pos, pc_src, ui16_first);
+	memcpy(ring->pc_buff, pc_src + ui16_first, ui16_count - ui16_first);
+	RING_BARRIER();
+
+	ring->head = head + ui16_count;
+
+	return (ui16_count);
+}
+
+// END
@@ -0,0 +1,258 @@
+/*!
+ * \file ring.h
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief Lock-free single producer / single consumer byte ring buffer - definitions
+ * \details
+ * Ring buffer shared between exactly one producer and one consumer (e.g. interrupt handler and main loop).
+ * No locking is required as long as each side only modifies its own index: producer owns head,
+ * consumer owns tail. Indices are free running and are masked only on buffer access, so full and empty
+ * states are distinguished without additional flags and used space is a single subtraction.
+ *
+ * Buffer size has to be a power of two and may not exceed RING_SIZE_MAX.
+ *
+ * This library uses following optional definitions from config.h:
+ * - RING_BIG_BUFFERS - enable support for buffers bigger than 128 bytes (16-bit indices)
+ * - RING_BARRIER - memory barrier used between buffer access and index update, defaults to compiler barrier
+ *   (sufficient for interrupt handler and main loop on single core only)
+ */
+
+#ifndef _RING_H
+#define _RING_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#include "config.h"
+#include "ehal/global.h"
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+/*!
+ * \typedef ring_size_t
+ * \brief type of ring indices and sizes
+ */
+#ifdef RING_BIG_BUFFERS
+typedef UINT16 ring_size_t;
+#define RING_SIZE_MAX 0x8000
+#else
+typedef UINT8 ring_size_t;
+#define RING_SIZE_MAX 0x80
+#endif // RING_BIG_BUFFERS
+
+/*!
+ * \def RING_SIZE_VALID
+ * \brief checks whether given size can be used as ring size (usable in preprocessor checks)
+ */
+#define RING_SIZE_VALID(size) ((size) && !((size) & ((size) - 1)) && ((size) <= RING_SIZE_MAX))
+
+/*!
+ * \def RING_BARRIER
+ * \brief orders buffer access against index update
+ * \note Default compiler barrier is valid only when producer and consumer run on the same single core
+ * (interrupt handler vs main loop). Producer and consumer on different cores or host threads need hardware
+ * fence, e.g. RING_BARRIER() defined as __atomic_thread_fence(__ATOMIC_SEQ_CST) in config.h.
+ */
+#ifndef RING_BARRIER
+#define RING_BARRIER() __asm__ __volatile__("" ::: "memory")
+#endif // RING_BARRIER
+
+/*!
+ * \struct ring_st
+ * \brief ring buffer control structure
+ */
+typedef struct
+{
+	BYTE *pc_buff;
+	ring_size_t mask;
+	volatile ring_size_t head;
+	volatile ring_size_t tail;
+} ring_st;
+
+/*!
+ * \struct ring_span_st
+ * \brief region of ring data given by free running start index and length
+ */
+typedef struct
+{
+	ring_size_t start;
+	ring_size_t length;
+} ring_span_st;
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+/*!
+ * \fn ringConsume(ring_st *ring, const UINT16 ui16_length)
+ * \brief consumer: releases bytes previously inspected with ringPeek
+ * \param ring pointer to ring control structure
+ * \param ui16_length number of bytes to release (limited to used space)
+ */
+VOID ringConsume(ring_st *ring, const UINT16 ui16_length);
+/*!
+ * \fn ringInit(ring_st *ring, BYTE *pc_buff, const UINT16 ui16_size)
+ * \brief initializes ring over given storage, ring is empty afterwards
+ * \param ring pointer to ring control structure
+ * \param pc_buff storage for ring data
+ * \param ui16_size size of storage, power of two not bigger than RING_SIZE_MAX
+ * \note Not safe against concurrent producer or consumer.
+ */
+VOID ringInit(ring_st *ring, BYTE *pc_buff, const UINT16 ui16_size);
+/*!
+ * \fn ringPeek(const ring_st *ring, BYTE **ppc_data)
+ * \brief consumer: gives access to oldest contiguous readable region without copying
+ * \param ring pointer to ring control structure
+ * \param ppc_data location for pointer to region start
+ * \return length of contiguous region, 0 if ring is empty
+ * \note If data wraps around end of storage, remaining part is available after ringConsume.
+ */
+UINT16 ringPeek(const ring_st *ring, BYTE **ppc_data);
+/*!
+ * \fn ringRead(ring_st *ring, BYTE *pc_dst, const UINT16 ui16_length)
+ * \brief consumer: copies up to ui16_length bytes out of ring
+ * \param ring pointer to ring control structure
+ * \param pc_dst destination buffer
+ * \param ui16_length max number of bytes to read
+ * \return number of bytes read
+ */
+UINT16 ringRead(ring_st *ring, BYTE *pc_dst, const UINT16 ui16_length);
+/*!
+ * \fn ringWrite(ring_st *ring, const BYTE *pc_src, const UINT16 ui16_length)
+ * \brief producer: copies up to ui16_length bytes into ring
+ * \param ring pointer to ring control structure
+ * \param pc_src source buffer
+ * \param ui16_length max number of bytes to write
+ * \return number of bytes written
+ */
+UINT16 ringWrite(ring_st *ring, const BYTE *pc_src, const UINT16 ui16_length);
+
+/*!
+ * \fn ringSize(const ring_st *ring)
+ * \brief ring capacity
+ * \param ring pointer to ring control structure
+ * \return number of bytes ring can hold
+ */
+static inline UINT16 ringSize(const ring_st *ring)
+{
+	return ((UINT16)ring->mask + 1);
+}
+
+/*!
+ * \fn ringAt(const ring_st *ring, const ring_size_t index)
+ * \brief access byte at free running index without consuming it
+ * \param ring pointer to ring control structure
+ * \param index free running index (e.g. tail + offset)
+ * \return byte stored at index
+ */
+static inline BYTE ringAt(const ring_st *ring, const ring_size_t index)
+{
+	return (ring->pc_buff[index & ring->mask]);
+}
+
+/*!
+ * \fn ringUsed(const ring_st *ring)
+ * \brief number of bytes waiting in ring
+ * \param ring pointer to ring control structure
+ * \return used space
+ */
+static inline ring_size_t ringUsed(const ring_st *ring)
+{
+	return ((ring_size_t)(ring->head - ring->tail));
+}
+
+/*!
+ * \fn ringFree(const ring_st *ring)
+ * \brief number of bytes that can be written to ring
+ * \param ring pointer to ring control structure
+ * \return free space
+ */
+static inline UINT16 ringFree(const ring_st *ring)
+{
+	return (ringSize(ring) - ringUsed(ring));
+}
+
+/*!
+ * \fn ringIsEmpty(const ring_st *ring)
+ * \brief tells whether ring is empty
+ * \param ring pointer to ring control structure
+ * \return true if ring is empty, false otherwise
+ */
+static inline BOOL ringIsEmpty(const ring_st *ring)
+{
+	return (ring->head == ring->tail);
+}
+
+/*!
+ * \fn ringIsFull(const ring_st *ring)
+ * \brief tells whether ring is full
+ * \param ring pointer to ring control structure
+ * \return true if ring is full, false otherwise
+ */
+static inline BOOL ringIsFull(const ring_st *ring)
+{
+	return (ringUsed(ring) > ring->mask);
+}
+
+/*!
+ * \fn ringPut(ring_st *ring, const BYTE c_byte)
+ * \brief producer: inserts single byte into ring
+ * \param ring pointer to ring control structure
+ * \param c_byte byte to insert
+ * \return true if byte was inserted, false if ring is full
+ */
+static inline BOOL ringPut(ring_st *ring, const BYTE c_byte)
+{
+	ring_size_t head = ring->head;
+
+	if ((ring_size_t)(head - ring->tail) > ring->mask)
+		return (false);
+
+	ring->pc_buff[head & ring->mask] = c_byte;
+	RING_BARRIER();
+	ring->head = head + 1;
+
+	return (true);
+}
+
+/*!
+ * \fn ringGet(ring_st *ring, BYTE *pc_byte)
+ * \brief consumer: takes single byte from ring
+ * \param ring pointer to ring control structure
+ * \param pc_byte location for taken byte
+ * \return true if byte was taken, false if ring is empty
+ */
+static inline BOOL ringGet(ring_st *ring, BYTE *pc_byte)
+{
+	ring_size_t tail = ring->tail;
+
+	if (ring->head == tail)
+		return (false);
+
+	RING_BARRIER();
+	*pc_byte = ring->pc_buff[tail & ring->mask];
+	RING_BARRIER();
+	ring->tail = tail + 1;
+
+	return (true);
+}
+
+#ifdef __cplusplus
+}
+#endif // extern "C"
+
+#endif // _RING_H
+
+// END
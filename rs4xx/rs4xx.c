@@ -14,7 +14,7 @@
  * \date 11.03.2016
  * \version 1
  *
- * \brief Blocking RS422/485 interface handler - implementation.
+ * \brief Interrupt driven RS422/485 interface handler - implementation.
  * \note
  * For detailed description see header file.
  */
@@ -29,49 +29,78 @@
 #include "lib/usart/usart_march.h"
 
 
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+// static functions
+static void rs4xx_txBegin(usart_cfg_st *usart);
+static void rs4xx_txEnd(usart_cfg_st *usart);
+
+
 /***************************************************************************
  *	FUNCTIONS
  ***************************************************************************/
 
 // --------------------------------------------------------------------------
-void rs4xxSend(usart_cfg_st *usart, const BYTE* pc_str, const UINT16 ui16_length)
+void rs4xxIsrTxComplete(usart_cfg_st *usart)
 {
-	UINT16 ui16_computed_length;
+	// data queued meanwhile, transmitter is still fed from tx ring
+	if (usartUnsentBytes(usart))
+		return;
 
-	// compute max length of data to send
-	if (!ui16_length)
-		ui16_computed_length = USART_SEND_MAX_LENGTH;
-	else
-		ui16_computed_length = (ui16_length > USART_SEND_MAX_LENGTH)?(USART_SEND_MAX_LENGTH):(ui16_length);
+	USART_ITConfig((USART_TypeDef*)usart->usart_if, USART_IT_TC, DISABLE);
+	RS4XX_TX_DIS();
+	usart->b_rs4xx_tx_active = false;
+}
 
-	// start sending data
-	for (UINT16 i = 0; i < ui16_computed_length; ++i)
-		rs4xxSendByte(usart, *(pc_str + i));
+// --------------------------------------------------------------------------
+void rs4xxSend(usart_cfg_st *usart, const BYTE* pc_str, const UINT16 ui16_length)
+{
+	rs4xx_txBegin(usart);
+	usartSend(usart, pc_str, ui16_length);
+	rs4xx_txEnd(usart);
 }
 
 // --------------------------------------------------------------------------
 void rs4xxSendByte(usart_cfg_st *usart, const BYTE c_byte)
 {
-	RS4XX_TX_ENA();
+	rs4xx_txBegin(usart);
 	usartSendByte(usart, c_byte);
-	WAIT_FOR(USART_GetFlagStatus((USART_TypeDef*)usart->usart_if, USART_FLAG_TC) == RESET);
-	RS4XX_TX_DIS();
+	rs4xx_txEnd(usart);
 }
 
 // --------------------------------------------------------------------------
 void rs4xxSendString(usart_cfg_st *usart, const BYTE* pc_str, const UINT16 ui16_length)
 {
-	UINT16 ui16_computed_length;
+	rs4xx_txBegin(usart);
+	usartSendString(usart, pc_str, ui16_length);
+	rs4xx_txEnd(usart);
+}
+
+// --------------------------------------------------------------------------
+BOOL rs4xxTxActive(const usart_cfg_st *usart)
+{
+	return (usart->b_rs4xx_tx_active);
+}
+
+// static functions
+// --------------------------------------------------------------------------
+static void rs4xx_txBegin(usart_cfg_st *usart)
+{
+	// keep transmission complete interrupt away while data is queued
+	USART_ITConfig((USART_TypeDef*)usart->usart_if, USART_IT_TC, DISABLE);
 
-	// compute max length of data to send
-	if (!ui16_length)
-		ui16_computed_length = USART_SEND_MAX_LENGTH;
-	else
-		ui16_computed_length = (ui16_length > USART_SEND_MAX_LENGTH)?(USART_SEND_MAX_LENGTH):(ui16_length);
+	usart->b_rs4xx_tx_active = true;
+	RS4XX_TX_ENA();
+	USART_ClearFlag((USART_TypeDef*)usart->usart_if, USART_FLAG_TC);
+}
 
-	// start sending data
-	for (UINT16 i = 0; (i < ui16_computed_length) && *(pc_str + i); ++i)
-		rs4xxSendByte(usart, *(pc_str + i));
+// --------------------------------------------------------------------------
+static void rs4xx_txEnd(usart_cfg_st *usart)
+{
+	// release driver after last queued byte leaves shift register
+	USART_ITConfig((USART_TypeDef*)usart->usart_if, USART_IT_TC, ENABLE);
 }
 
 // END
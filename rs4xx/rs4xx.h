@@ -5,9 +5,14 @@
  * \date 11.03.2016
  * \version 1
  *
- * \brief Blocking RS422/485 interface handler - definitions.
+ * \brief Interrupt driven RS422/485 interface handler - definitions.
  * \details
- * Blocking implementation of RS422/485 control handler.
+ * Non-blocking implementation of RS422/485 control handler. Whole frame is queued in usart tx ring and
+ * transceiver driver is enabled once (RS4XX_TX_ENA), so bytes are sent back to back. Driver is released
+ * (RS4XX_TX_DIS) from transmission complete interrupt after the last byte left the transmitter.
+ * Architecture usart interrupt handler has to call rs4xxIsrTxComplete() on transmission complete event.
+ * Transmission state is kept per port, usart_cfg_st provided by usart_march.h has to contain additionally:
+ * - b_rs4xx_tx_active - volatile BOOL, transceiver driver enabled
  * \warning
  * Depending on MCU architecture additional configuration definitions may be required.
  * Implementation for particular architecture is contained in related version of library in spi_march.c.
@@ -31,9 +36,38 @@ extern "C" {
  *	FUNCTIONS
  ***************************************************************************/
 
+/*!
+ * \fn rs4xxIsrTxComplete(usart_cfg_st *usart)
+ * \brief release transceiver driver if nothing more is queued, to be called from usart transmission
+ * complete interrupt handler
+ */
+void rs4xxIsrTxComplete(usart_cfg_st *usart);
+/*!
+ * \fn rs4xxSend(usart_cfg_st *usart, const BYTE* pc_str, const UINT16 ui16_length)
+ * \brief queue data for transmission, returns as soon as data is in tx ring
+ * \param pc_str data to be sent
+ * \param ui16_length length of data (limited to USART_SEND_MAX_LENGTH)
+ */
 void rs4xxSend(usart_cfg_st *usart, const BYTE* pc_str, const UINT16 ui16_length);
+/*!
+ * \fn rs4xxSendByte(usart_cfg_st *usart, const BYTE c_byte)
+ * \brief queue single byte for transmission
+ * \param c_byte byte to be sent
+ */
 void rs4xxSendByte(usart_cfg_st *usart, const BYTE c_byte);
+/*!
+ * \fn rs4xxSendString(usart_cfg_st *usart, const BYTE* pc_str, const UINT16 ui16_length)
+ * \brief queue string for transmission
+ * \param pc_str string to be sent
+ * \param ui16_length max length of string (limited to USART_SEND_MAX_LENGTH)
+ */
 void rs4xxSendString(usart_cfg_st *usart, const BYTE* pc_str, const UINT16 ui16_length);
+/*!
+ * \fn rs4xxTxActive(const usart_cfg_st *usart)
+ * \brief tells whether transceiver driver of given port is enabled
+ * \return true until transmission of all queued data completes, false otherwise
+ */
+BOOL rs4xxTxActive(const usart_cfg_st *usart);
 
 #ifdef __cplusplus
 }
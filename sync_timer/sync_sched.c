@@ -0,0 +1,204 @@
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+/*!
+ * \file sync_sched.c
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief Cooperative run-to-completion task scheduler - implementation.
+ * \note
+ * For detailed description see header file.
+ */
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#include "ehal/sync_timer/sync_sched.h"
+
+#include <string.h>
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+// definitions check
+#ifndef SYNC_TIMER_JIFFIES
+	#error "SYNC_SCHED: SYNC_TIMER_JIFFIES is not set!"
+#endif // SYNC_TIMER_JIFFIES
+
+// task states
+#define SYNC_SCHED_STATE_IDLE 0
+#define SYNC_SCHED_STATE_QUEUED 1
+#define SYNC_SCHED_STATE_RUNNING 2
+
+// tasks sorted by release time
+static sync_sched_task_st *p_sync_sched_queue = NULL;
+
+// static functions
+static UINT32 sync_sched_deadline(const sync_sched_task_st *task);
+static VOID sync_sched_insert(sync_sched_task_st *task);
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+// --------------------------------------------------------------------------
+VOID syncSchedAdd(sync_sched_task_st *task, const sync_sched_fnc_t fnc, VOID *pv_arg, const UINT32 ui32_period, const UINT8 ui8_priority, const UINT32 ui32_deadline)
+{
+	syncSchedRemove(task);
+
+	task->fnc = fnc;
+	task->pv_arg = pv_arg;
+	task->ui32_period = ui32_period;
+	task->ui32_deadline = ui32_deadline;
+	task->ui8_priority = ui8_priority;
+	task->ui32_release = jiffies + ui32_period;
+	memset(&task->stats, 0, sizeof(task->stats));
+
+	sync_sched_insert(task);
+}
+
+// --------------------------------------------------------------------------
+BOOL syncSchedNextRelease(UINT32 *pui32_ticks)
+{
+	UINT32 ui32_now = jiffies;
+
+	if (!p_sync_sched_queue)
+		return (false);
+
+	*pui32_ticks = TIME_AFTER(p_sync_sched_queue->ui32_release, ui32_now)?(p_sync_sched_queue->ui32_release - ui32_now):(0);
+
+	return (true);
+}
+
+// --------------------------------------------------------------------------
+VOID syncSchedRemove(sync_sched_task_st *task)
+{
+	sync_sched_task_st **pp;
+
+	// running task is only marked, so it is not rescheduled
+	if (SYNC_SCHED_STATE_QUEUED != task->ui8_state)
+	{
+		task->ui8_state = SYNC_SCHED_STATE_IDLE;
+		return;
+	}
+
+	for (pp = &p_sync_sched_queue; *pp; pp = &(*pp)->next)
+	{
+		if (*pp == task)
+		{
+			*pp = task->next;
+			break;
+		}
+	}
+
+	task->next = NULL;
+	task->ui8_state = SYNC_SCHED_STATE_IDLE;
+}
+
+// --------------------------------------------------------------------------
+BOOL syncSchedRun(void)
+{
+	sync_sched_task_st **pp, **pp_best = NULL;
+	sync_sched_task_st *task;
+	UINT32 ui32_start = jiffies;
+	UINT32 ui32_end, ui32_runtime, ui32_release, ui32_deadline;
+	BOOL b_deadline;
+
+	// released tasks are at the head of queue, pick the one with earliest deadline
+	for (pp = &p_sync_sched_queue; *pp && TIME_AFTER_EQ(ui32_start, (*pp)->ui32_release); pp = &(*pp)->next)
+	{
+		if (!pp_best || TIME_BEFORE(sync_sched_deadline(*pp), sync_sched_deadline(*pp_best))
+			|| ((sync_sched_deadline(*pp) == sync_sched_deadline(*pp_best)) && ((*pp)->ui8_priority < (*pp_best)->ui8_priority)))
+			pp_best = pp;
+	}
+
+	if (!pp_best)
+	{
+#ifdef SYNC_SCHED_IDLE_HANDLER
+		UINT32 ui32_ticks;
+
+		if (!syncSchedNextRelease(&ui32_ticks))
+			ui32_ticks = 0xFFFFFFFF;
+		syncSchedIdleHandler(ui32_ticks);
+#endif // SYNC_SCHED_IDLE_HANDLER
+		return (false);
+	}
+
+	// dequeue before execution, so task may remove or re-add itself
+	task = *pp_best;
+	*pp_best = task->next;
+	task->next = NULL;
+	task->ui8_state = SYNC_SCHED_STATE_RUNNING;
+	// task re-adding itself changes its release and deadline
+	ui32_release = task->ui32_release;
+	ui32_deadline = sync_sched_deadline(task);
+	b_deadline = (task->ui32_deadline || task->ui32_period);
+
+	task->fnc(task->pv_arg);
+
+	// re-added task has its statistics cleared and is already queued
+	ui32_end = jiffies;
+	if (SYNC_SCHED_STATE_QUEUED == task->ui8_state)
+		return (true);
+
+	ui32_runtime = ui32_end - ui32_start;
+	++task->stats.ui32_runs;
+	task->stats.ui32_runtime_last = ui32_runtime;
+	if (ui32_runtime > task->stats.ui32_runtime_max)
+		task->stats.ui32_runtime_max = ui32_runtime;
+	if ((ui32_start - ui32_release) > task->stats.ui32_lateness_max)
+		task->stats.ui32_lateness_max = ui32_start - ui32_release;
+	if (b_deadline && TIME_AFTER(ui32_end, ui32_deadline))
+		++task->stats.ui32_deadline_misses;
+
+	// reschedule periodic task keeping its phase, overrun releases are skipped
+	if (SYNC_SCHED_STATE_RUNNING != task->ui8_state)
+		return (true);
+
+	task->ui8_state = SYNC_SCHED_STATE_IDLE;
+	if (task->ui32_period)
+	{
+		task->ui32_release += task->ui32_period;
+		// skipped releases are whole periods, so next release stays on the original grid
+		if (TIME_BEFORE(task->ui32_release, ui32_end))
+			task->ui32_release += task->ui32_period * ((ui32_end - task->ui32_release + task->ui32_period - 1) / task->ui32_period);
+		sync_sched_insert(task);
+	}
+
+	return (true);
+}
+
+// static functions
+// --------------------------------------------------------------------------
+static UINT32 sync_sched_deadline(const sync_sched_task_st *task)
+{
+	return (task->ui32_release + ((task->ui32_deadline)?(task->ui32_deadline):(task->ui32_period)));
+}
+
+// --------------------------------------------------------------------------
+static VOID sync_sched_insert(sync_sched_task_st *task)
+{
+	sync_sched_task_st **pp;
+
+	// keep queue sorted by release time, FIFO for equal releases
+	for (pp = &p_sync_sched_queue; *pp && TIME_BEFORE_EQ((*pp)->ui32_release, task->ui32_release); pp = &(*pp)->next);
+
+	task->next = *pp;
+	*pp = task;
+	task->ui8_state = SYNC_SCHED_STATE_QUEUED;
+}
+
+// END
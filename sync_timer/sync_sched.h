@@ -0,0 +1,142 @@
+/*!
+ * \file sync_sched.h
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief Cooperative run-to-completion task scheduler - definitions
+ * \details
+ * Replaces main loop polling of sync timers with deadline ordered dispatch. Tasks are registered with
+ * period, priority and optional relative deadline and are kept in list sorted by release time, so
+ * checking whether anything is due costs a single comparison. Among released tasks the one with earliest
+ * absolute deadline (release + deadline, or release + period if no deadline was given) is executed,
+ * priority decides between equal deadlines. Each task runs to completion. Periodic task keeps its phase,
+ * releases which passed while task (or other ones) overran are skipped.
+ *
+ * For each task number of runs, last and max runtime, max lateness (delay between release and start)
+ * and deadline misses are recorded. Max lateness of all tasks gives worst-case loop latency.
+ *
+ * This library needs following definitions to be set in config.h:
+ * - SYNC_TIMER_JIFFIES - jiffies are used as time base, all times are given in jiffies
+ * Optional:
+ * - SYNC_SCHED_IDLE_HANDLER - if defined user handler is executed when no task is due
+ *
+ * \note
+ * Tasks must not be added or removed from interrupts.
+ */
+
+#ifndef _SYNC_SCHED_H
+#define _SYNC_SCHED_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#include "config.h"
+#include "ehal/global.h"
+#include "ehal/sync_timer/sync_timer.h"
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+/*!
+ * \typedef sync_sched_fnc_t
+ * \brief task function
+ */
+typedef VOID (*sync_sched_fnc_t)(VOID *pv_arg);
+
+/*!
+ * \struct sync_sched_stats_st
+ * \brief task statistics, times in jiffies
+ */
+typedef struct
+{
+	UINT32 ui32_runs;
+	UINT32 ui32_runtime_last;
+	UINT32 ui32_runtime_max;
+	UINT32 ui32_lateness_max;
+	UINT32 ui32_deadline_misses;
+} sync_sched_stats_st;
+
+/*!
+ * \struct sync_sched_task_st
+ * \brief task, fields except stats are used internally
+ */
+typedef struct sync_sched_task_s
+{
+	struct sync_sched_task_s *next;
+	UINT8 ui8_state;
+
+	sync_sched_fnc_t fnc;
+	VOID *pv_arg;
+	UINT32 ui32_period;
+	UINT32 ui32_deadline;
+	UINT8 ui8_priority;
+
+	UINT32 ui32_release;
+
+	sync_sched_stats_st stats;
+} sync_sched_task_st;
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+/*!
+ * \fn syncSchedAdd(sync_sched_task_st *task, const sync_sched_fnc_t fnc, VOID *pv_arg, const UINT32 ui32_period, const UINT8 ui8_priority, const UINT32 ui32_deadline)
+ * \brief registers task, queued task is rescheduled, statistics are cleared
+ * \param task task storage, has to be zeroed before first use and valid until task is removed
+ * \param fnc task function
+ * \param pv_arg task function argument
+ * \param ui32_period jiffies between releases, 0 for one-shot task
+ * \param ui8_priority priority used for equal deadlines, lower value means higher priority
+ * \param ui32_deadline jiffies from release to task completion, 0 if period is the deadline
+ * \note task is released for the first time one period after registration (immediately for one-shot task)
+ * \note may be invoked from task itself, current run is then not counted in statistics
+ */
+VOID syncSchedAdd(sync_sched_task_st *task, const sync_sched_fnc_t fnc, VOID *pv_arg, const UINT32 ui32_period, const UINT8 ui8_priority, const UINT32 ui32_deadline);
+/*!
+ * \fn syncSchedRemove(sync_sched_task_st *task)
+ * \brief removes task from scheduler, may be invoked from task itself
+ * \param task task to remove
+ */
+VOID syncSchedRemove(sync_sched_task_st *task);
+/*!
+ * \fn syncSchedRun
+ * \brief executes single due task or idle handler when nothing is due, have to be invoked in main loop
+ * \return true if task was executed, false otherwise
+ */
+BOOL syncSchedRun(void);
+/*!
+ * \fn syncSchedNextRelease(UINT32 *pui32_ticks)
+ * \brief gets time to the nearest task release
+ * \param pui32_ticks jiffies to the nearest release, 0 if any task is due
+ * \return false if no task is registered, true otherwise
+ */
+BOOL syncSchedNextRelease(UINT32 *pui32_ticks);
+
+#ifdef SYNC_SCHED_IDLE_HANDLER
+/*!
+ * \fn syncSchedIdleHandler(const UINT32 ui32_ticks)
+ * \brief user handler executed when no task is due, may put cpu to sleep
+ * \param ui32_ticks jiffies to the nearest release, 0xFFFFFFFF if no task is registered
+ * \note function is unavailable if SYNC_SCHED_IDLE_HANDLER is not declared in config.h
+ */
+VOID syncSchedIdleHandler(const UINT32 ui32_ticks);
+#endif // SYNC_SCHED_IDLE_HANDLER
+
+#ifdef __cplusplus
+}
+#endif // extern "C"
+
+#endif // _SYNC_SCHED_H
+
+// END
@@ -27,6 +27,11 @@
 #include "ehal/global.h"
 #include "ehal/sync_timer/sync_timer.h"
 
+#ifdef SYNC_TIMER_STATS
+#include <stdio.h>
+#include <string.h>
+#endif // SYNC_TIMER_STATS
+
 /***************************************************************************
  *	DEFINITIONS
  ***************************************************************************/
@@ -36,6 +41,29 @@
 	#error "SYNC_TIMER: SYNC_TIMER_TIMERS is not set!"
 #endif // SYNC_TIMER_TIMERS
 
+#ifdef SYNC_TIMER_WHEEL
+#if ((SYNC_TIMER_WHEEL_BITS * SYNC_TIMER_WHEEL_LEVELS) > 30)
+	#error "SYNC_TIMER: wheel range exceeds 30 bits!"
+#endif
+
+#define SYNC_TIMER_WHEEL_SLOTS BV(SYNC_TIMER_WHEEL_BITS)
+#define SYNC_TIMER_WHEEL_MASK (SYNC_TIMER_WHEEL_SLOTS - 1)
+#define SYNC_TIMER_WHEEL_RANGE(level) (1UL << (SYNC_TIMER_WHEEL_BITS * (level)))
+#endif // SYNC_TIMER_WHEEL
+
+#if defined(SYNC_TIMER_US) && !defined(SYNC_TIMER_JIFFIES)
+	#error "SYNC_TIMER: SYNC_TIMER_US requires SYNC_TIMER_JIFFIES!"
+#endif
+
+#ifdef SYNC_TIMER_TICKLESS
+#if ((SYNC_TIMER_COUNTER_BITS == 16) && (SYNC_TIMER_TICKLESS_MAX > 0x7FFF))
+	#error "SYNC_TIMER: SYNC_TIMER_TICKLESS_MAX exceeds 16-bit timer counter range!"
+#endif
+
+// longest sleep keeping ticks not processed yet within half of tick_type_t range
+#define SYNC_TIMER_TICKS_SAFE ((UINT32)((tick_type_t)~(tick_type_t)0 >> 1))
+#endif // SYNC_TIMER_TICKLESS
+
 // timer counter
 volatile UINT8 ui8_sync_timer_overflow = 0;
 
@@ -43,38 +71,116 @@ volatile UINT8 ui8_sync_timer_overflow = 0;
 volatile tick_type_t ticks = 0;
 
 #ifdef SYNC_TIMER_JIFFIES
-volatile UINT32 jiffies = 0;
+volatile UINT32 jiffies = (UINT32)(SYNC_TIMER_JIFFIES_INIT);
 #endif // SYNC_TIMER_JIFFIES
 
+#if (SYNC_TIMER_TIMERS > 0)
+#if (SYNC_TIMER_COUNTER_BITS == 16)
 // array of timer tick information
 volatile UINT16 aui16_timers[SYNC_TIMER_TIMERS];
+#else
+// array of timer tick information and bitmap of running timers
+volatile sync_timer_cnt_t a_timers[SYNC_TIMER_TIMERS];
+volatile UINT8 aui8_timers_run[(SYNC_TIMER_TIMERS + 7) / 8];
+#endif // SYNC_TIMER_COUNTER_BITS
+#ifdef SYNC_TIMER_TICKLESS
+// latest value checked with syncTimerGetTimer(), 0 if unknown
+static sync_timer_cnt_t a_timers_period[SYNC_TIMER_TIMERS];
+#endif // SYNC_TIMER_TICKLESS
+#endif // SYNC_TIMER_TIMERS
+
+#ifdef SYNC_TIMER_STATS
+#if (SYNC_TIMER_TIMERS > 0)
+static sync_timer_stats_st a_timers_stats[SYNC_TIMER_TIMERS];
+#endif // SYNC_TIMER_TIMERS
+// longest gap between syncTimerUpdate() calls and ticks slept since last one
+static volatile tick_type_t sync_timer_gap_max = 0;
+static volatile tick_type_t sync_timer_slept = 0;
+
+#if (SYNC_TIMER_TIMERS > 0)
+// static functions
+static VOID sync_timer_statsExpiry(const UINT8 ui8_timer, sync_timer_cnt_t lateness);
+#endif // SYNC_TIMER_TIMERS
+#endif // SYNC_TIMER_STATS
+
+#ifdef SYNC_TIMER_TICKLESS
+// static functions
+static UINT32 sync_timer_sleep(UINT32 ui32_ticks);
+#endif // SYNC_TIMER_TICKLESS
+
+#ifdef SYNC_TIMER_WHEEL
+// wheel slots, each one is a list of timers
+static sync_timer_st *ap_sync_timer_wheel[SYNC_TIMER_WHEEL_LEVELS][SYNC_TIMER_WHEEL_SLOTS];
+// next tick to be processed by wheel
+static UINT32 ui32_sync_timer_wheel_now = 0;
+// number of pending timers
+static UINT16 ui16_sync_timer_wheel_pending = 0;
+
+// static functions
+static VOID sync_timer_wheelAdvance(tick_type_t elapsed);
+static VOID sync_timer_wheelCascade(const UINT8 ui8_level, const UINT8 ui8_slot);
+static VOID sync_timer_wheelInsert(sync_timer_st *timer);
+#ifdef SYNC_TIMER_TICKLESS
+static UINT32 sync_timer_wheelNext(void);
+#endif // SYNC_TIMER_TICKLESS
+static VOID sync_timer_wheelUnlink(sync_timer_st *timer);
+#endif // SYNC_TIMER_WHEEL
 
 
 /***************************************************************************
  *	FUNCTIONS
  ***************************************************************************/
 
+#if (SYNC_TIMER_TIMERS > 0)
 // --------------------------------------------------------------------------
-BOOL syncTimerGetTimer(const UINT8 ui8_timer, const UINT16 ui16_value)
+BOOL syncTimerGetTimer(const UINT8 ui8_timer, const sync_timer_cnt_t value)
 {
 	// indicates whether timer is reached
 	BOOL b;
 
+#ifdef SYNC_TIMER_TICKLESS
+	a_timers_period[ui8_timer] = value;
+#endif // SYNC_TIMER_TICKLESS
+
+#if (SYNC_TIMER_COUNTER_BITS == 16)
 	// check whether timer is running
 	if (!(aui16_timers[ui8_timer] & SYNC_TIMER_RUN_MASK))
 		return (false);
 
-	b = ((aui16_timers[ui8_timer] & ~(SYNC_TIMER_RUN_MASK)) >= ui16_value);
+	b = ((aui16_timers[ui8_timer] & ~(SYNC_TIMER_RUN_MASK)) >= value);
 
 	// reset timer if already exceeded
 	if (b)
 	{
+#ifdef SYNC_TIMER_STATS
+		sync_timer_statsExpiry(ui8_timer, (aui16_timers[ui8_timer] & ~(SYNC_TIMER_RUN_MASK)) - value);
+#endif // SYNC_TIMER_STATS
 #ifdef SYNC_TIMER_MAINTAIN_PERIOD
-		aui16_timers[ui8_timer] -= ui16_value;
+		aui16_timers[ui8_timer] -= value;
 #else
 		aui16_timers[ui8_timer] = SYNC_TIMER_RUN_MASK;
 #endif // SYNC_TIMER_MAINTAIN_PERIOD
 	}
+#else
+	// check whether timer is running
+	if (!(aui8_timers_run[ui8_timer >> 3] & BV(ui8_timer & 0x07)))
+		return (false);
+
+	b = (a_timers[ui8_timer] >= value);
+
+	// reset timer if already exceeded
+	if (b)
+	{
+#ifdef SYNC_TIMER_STATS
+		sync_timer_statsExpiry(ui8_timer, a_timers[ui8_timer] - value);
+#endif // SYNC_TIMER_STATS
+#ifdef SYNC_TIMER_MAINTAIN_PERIOD
+		a_timers[ui8_timer] -= value;
+#else
+		a_timers[ui8_timer] = 0;
+#endif // SYNC_TIMER_MAINTAIN_PERIOD
+	}
+#endif // SYNC_TIMER_COUNTER_BITS
 
 	return (b);
 }
@@ -82,38 +188,441 @@ BOOL syncTimerGetTimer(const UINT8 ui8_timer, const UINT16 ui16_value)
 // --------------------------------------------------------------------------
 VOID syncTimerRestart(const UINT8 ui8_timer)
 {
+#if (SYNC_TIMER_COUNTER_BITS == 16)
 	// reset tick count and set start bit
 	aui16_timers[ui8_timer] = SYNC_TIMER_RUN_MASK;
+#else
+	a_timers[ui8_timer] = 0;
+	sbi(aui8_timers_run[ui8_timer >> 3], ui8_timer & 0x07);
+#endif // SYNC_TIMER_COUNTER_BITS
 }
 
 // --------------------------------------------------------------------------
 VOID syncTimerStart(const UINT8 ui8_timer)
 {
 	// set start bit
+#if (SYNC_TIMER_COUNTER_BITS == 16)
 	sbi(aui16_timers[ui8_timer], SYNC_TIMER_RUN_BIT);
+#else
+	sbi(aui8_timers_run[ui8_timer >> 3], ui8_timer & 0x07);
+#endif // SYNC_TIMER_COUNTER_BITS
 }
 
 // --------------------------------------------------------------------------
 VOID syncTimerStop(const UINT8 ui8_timer)
 {
 	// clear start bit
+#if (SYNC_TIMER_COUNTER_BITS == 16)
 	cbi(aui16_timers[ui8_timer], SYNC_TIMER_RUN_BIT);
+#else
+	cbi(aui8_timers_run[ui8_timer >> 3], ui8_timer & 0x07);
+#endif // SYNC_TIMER_COUNTER_BITS
 }
+#endif // SYNC_TIMER_TIMERS
 
 // --------------------------------------------------------------------------
 VOID syncTimerUpdate(void)
 {
 	volatile UINT16 tmp_ticks = ticks;
+#if (SYNC_TIMER_TIMERS > 0)
 	// update all timers
 	for (UINT8 i = 0; i < SYNC_TIMER_TIMERS; ++i)
 	{
 		// update only running timers
+#if (SYNC_TIMER_COUNTER_BITS == 16)
 		if (aui16_timers[i] & SYNC_TIMER_RUN_MASK)
 			aui16_timers[i] += tmp_ticks;
+#else
+		if (aui8_timers_run[i >> 3] & BV(i & 0x07))
+			a_timers[i] += tmp_ticks;
+#endif // SYNC_TIMER_COUNTER_BITS
 	}
+#endif // SYNC_TIMER_TIMERS
 
 	// reset tick counters
 	ticks -= tmp_ticks;
+
+#ifdef SYNC_TIMER_STATS
+	if ((tick_type_t)(tmp_ticks - sync_timer_slept) > sync_timer_gap_max)
+		sync_timer_gap_max = tmp_ticks - sync_timer_slept;
+	sync_timer_slept = 0;
+#endif // SYNC_TIMER_STATS
+
+#ifdef SYNC_TIMER_WHEEL
+	sync_timer_wheelAdvance(tmp_ticks);
+#endif // SYNC_TIMER_WHEEL
+}
+
+#ifdef SYNC_TIMER_US
+// --------------------------------------------------------------------------
+VOID syncTimerDelayUntilUs(const UINT32 ui32_deadline)
+{
+#ifdef SYNC_TIMER_TICKLESS
+	UINT32 ui32_ticks;
+
+	// whole ticks are slept with periodic tick stopped, only remainder of the last one is busy waited
+	while (!syncTimerReachedUs(ui32_deadline))
+	{
+		ui32_ticks = (ui32_deadline - syncTimerNowUs()) / SYNC_TIMER_TICK_US;
+		if (ui32_ticks > SYNC_TIMER_TICKLESS_MAX)
+			ui32_ticks = SYNC_TIMER_TICKLESS_MAX;
+		if ((ui32_ticks < 2) || !sync_timer_sleep(ui32_ticks))
+			break;
+	}
+#endif // SYNC_TIMER_TICKLESS
+
+	while (!syncTimerReachedUs(ui32_deadline));
+}
+
+// --------------------------------------------------------------------------
+UINT32 syncTimerNowUs(void)
+{
+	UINT32 ui32_jiffies, ui32_elapsed;
+
+	// retry if tick was counted between reads
+	do
+	{
+		ui32_jiffies = jiffies;
+		ui32_elapsed = march_syncTimerElapsedUs();
+	}
+	while (ui32_jiffies != jiffies);
+
+	return (ui32_jiffies * SYNC_TIMER_TICK_US + ui32_elapsed);
+}
+
+// --------------------------------------------------------------------------
+BOOL syncTimerReachedUs(const UINT32 ui32_deadline)
+{
+	return (TIME_AFTER_EQ(syncTimerNowUs(), ui32_deadline));
+}
+#endif // SYNC_TIMER_US
+
+#ifdef SYNC_TIMER_STATS
+// --------------------------------------------------------------------------
+VOID syncTimerStatsDump(void)
+{
+#if (SYNC_TIMER_TIMERS > 0)
+	for (UINT8 i = 0; i < SYNC_TIMER_TIMERS; ++i)
+	{
+		printf("sync_timer %u: expiries %lu, max late %lu, histogram:", i,
+			(unsigned long)a_timers_stats[i].ui32_expiries, (unsigned long)a_timers_stats[i].lateness_max);
+		for (UINT8 j = 0; j < SYNC_TIMER_STATS_BUCKETS; ++j)
+			printf(" %u", a_timers_stats[i].aui16_lateness[j]);
+		printf("\n");
+	}
+#endif // SYNC_TIMER_TIMERS
+
+	printf("sync_timer loop gap max: %u\n", (unsigned int)sync_timer_gap_max);
+}
+
+#if (SYNC_TIMER_TIMERS > 0)
+// --------------------------------------------------------------------------
+VOID syncTimerStatsGet(const UINT8 ui8_timer, sync_timer_stats_st *stats)
+{
+	*stats = a_timers_stats[ui8_timer];
+}
+#endif // SYNC_TIMER_TIMERS
+
+// --------------------------------------------------------------------------
+VOID syncTimerStatsIsrTick(const tick_type_t pending)
+{
+	if ((tick_type_t)(pending - sync_timer_slept) > sync_timer_gap_max)
+		sync_timer_gap_max = pending - sync_timer_slept;
+}
+
+// --------------------------------------------------------------------------
+tick_type_t syncTimerStatsLoopGapMax(void)
+{
+	return (sync_timer_gap_max);
+}
+
+// --------------------------------------------------------------------------
+VOID syncTimerStatsReset(void)
+{
+#if (SYNC_TIMER_TIMERS > 0)
+	memset(a_timers_stats, 0, sizeof(a_timers_stats));
+#endif // SYNC_TIMER_TIMERS
+	sync_timer_gap_max = 0;
+}
+#endif // SYNC_TIMER_STATS
+
+#ifdef SYNC_TIMER_TICKLESS
+// --------------------------------------------------------------------------
+UINT32 syncTimerIdle(const UINT32 ui32_limit)
+{
+	UINT32 ui32_sleep = syncTimerNextExpiry();
+
+	if (ui32_limit < ui32_sleep)
+		ui32_sleep = ui32_limit;
+
+	// single tick is not worth reprogramming timer
+	if (ui32_sleep < 2)
+		return (0);
+
+	return (sync_timer_sleep(ui32_sleep));
+}
+
+// --------------------------------------------------------------------------
+UINT32 syncTimerNextExpiry(void)
+{
+	UINT32 ui32_next = SYNC_TIMER_TICKLESS_MAX;
+	tick_type_t pending = ticks;
+#if (SYNC_TIMER_TIMERS > 0)
+	sync_timer_cnt_t count;
+
+	for (UINT8 i = 0; i < SYNC_TIMER_TIMERS; ++i)
+	{
+		// stopped timers and timers not checked yet do not limit sleep
+#if (SYNC_TIMER_COUNTER_BITS == 16)
+		if (!(aui16_timers[i] & SYNC_TIMER_RUN_MASK) || !a_timers_period[i])
+			continue;
+		count = (aui16_timers[i] & ~(SYNC_TIMER_RUN_MASK)) + pending;
+#else
+		if (!(aui8_timers_run[i >> 3] & BV(i & 0x07)) || !a_timers_period[i])
+			continue;
+		count = a_timers[i] + pending;
+#endif // SYNC_TIMER_COUNTER_BITS
+
+		if (count >= a_timers_period[i])
+			return (0);
+		if ((UINT32)(a_timers_period[i] - count) < ui32_next)
+			ui32_next = a_timers_period[i] - count;
+	}
+#endif // SYNC_TIMER_TIMERS
+
+#ifdef SYNC_TIMER_WHEEL
+	{
+		UINT32 ui32_wheel = sync_timer_wheelNext();
+
+		if (ui32_wheel <= pending)
+			return (0);
+		if ((ui32_wheel - pending) < ui32_next)
+			ui32_next = ui32_wheel - pending;
+	}
+#endif // SYNC_TIMER_WHEEL
+
+	return (ui32_next);
+}
+#endif // SYNC_TIMER_TICKLESS
+
+#ifdef SYNC_TIMER_WHEEL
+// --------------------------------------------------------------------------
+VOID syncTimerAdd(sync_timer_st *timer, const UINT32 ui32_delay, const UINT32 ui32_period, const sync_timer_cb_t cb, VOID *pv_arg)
+{
+	syncTimerCancel(timer);
+
+	// wheel time points to next tick to be processed
+	timer->ui32_expires = ui32_sync_timer_wheel_now + ui32_delay - 1;
+	timer->ui32_period = ui32_period;
+	timer->cb = cb;
+	timer->pv_arg = pv_arg;
+
+	sync_timer_wheelInsert(timer);
+}
+
+// --------------------------------------------------------------------------
+VOID syncTimerCancel(sync_timer_st *timer)
+{
+	if (timer->pprev)
+		sync_timer_wheelUnlink(timer);
+}
+
+// --------------------------------------------------------------------------
+BOOL syncTimerPending(const sync_timer_st *timer)
+{
+	return (NULL != timer->pprev);
+}
+
+// static functions
+// --------------------------------------------------------------------------
+static VOID sync_timer_wheelAdvance(tick_type_t elapsed)
+{
+	sync_timer_st *list, *timer;
+	UINT8 ui8_slot;
+
+	while (elapsed--)
+	{
+		// nothing to expire, skip remaining ticks at once
+		if (!ui16_sync_timer_wheel_pending)
+		{
+			ui32_sync_timer_wheel_now += elapsed + 1;
+			return;
+		}
+
+		// on wrap of lower level move timers from next slot of upper level down
+		ui8_slot = ui32_sync_timer_wheel_now & SYNC_TIMER_WHEEL_MASK;
+		for (UINT8 ui8_level = 1; !ui8_slot && (ui8_level < SYNC_TIMER_WHEEL_LEVELS); ++ui8_level)
+		{
+			ui8_slot = (ui32_sync_timer_wheel_now >> (SYNC_TIMER_WHEEL_BITS * ui8_level)) & SYNC_TIMER_WHEEL_MASK;
+			sync_timer_wheelCascade(ui8_level, ui8_slot);
+		}
+
+		// detach expired slot, so callbacks may safely add and cancel timers
+		ui8_slot = ui32_sync_timer_wheel_now & SYNC_TIMER_WHEEL_MASK;
+		list = ap_sync_timer_wheel[0][ui8_slot];
+		ap_sync_timer_wheel[0][ui8_slot] = NULL;
+		if (list)
+			list->pprev = &list;
+		++ui32_sync_timer_wheel_now;
+
+		while (list)
+		{
+			timer = list;
+			sync_timer_wheelUnlink(timer);
+
+			if (timer->ui32_period)
+			{
+				timer->ui32_expires += timer->ui32_period;
+				sync_timer_wheelInsert(timer);
+			}
+			timer->cb(timer->pv_arg);
+		}
+	}
+}
+
+// --------------------------------------------------------------------------
+static VOID sync_timer_wheelCascade(const UINT8 ui8_level, const UINT8 ui8_slot)
+{
+	sync_timer_st *list = ap_sync_timer_wheel[ui8_level][ui8_slot];
+	sync_timer_st *timer;
+
+	ap_sync_timer_wheel[ui8_level][ui8_slot] = NULL;
+	while (list)
+	{
+		timer = list;
+		list = list->next;
+
+		--ui16_sync_timer_wheel_pending;
+		sync_timer_wheelInsert(timer);
+	}
+}
+
+// --------------------------------------------------------------------------
+static VOID sync_timer_wheelInsert(sync_timer_st *timer)
+{
+	UINT32 ui32_delta = timer->ui32_expires - ui32_sync_timer_wheel_now;
+	UINT32 ui32_expires = timer->ui32_expires;
+	sync_timer_st **head;
+	UINT8 ui8_level;
+
+	// already expired timers go to current slot
+	if (TIME_BEFORE(timer->ui32_expires, ui32_sync_timer_wheel_now))
+		ui32_expires = ui32_sync_timer_wheel_now;
+	// beyond wheel range, timer is cascaded again from the last level
+	else if (ui32_delta >= SYNC_TIMER_WHEEL_RANGE(SYNC_TIMER_WHEEL_LEVELS))
+		ui32_expires = ui32_sync_timer_wheel_now + SYNC_TIMER_WHEEL_RANGE(SYNC_TIMER_WHEEL_LEVELS) - 1;
+
+	ui32_delta = ui32_expires - ui32_sync_timer_wheel_now;
+	for (ui8_level = 0; ui8_level < (SYNC_TIMER_WHEEL_LEVELS - 1); ++ui8_level)
+	{
+		if (ui32_delta < SYNC_TIMER_WHEEL_RANGE(ui8_level + 1))
+			break;
+	}
+
+	head = &ap_sync_timer_wheel[ui8_level][(ui32_expires >> (SYNC_TIMER_WHEEL_BITS * ui8_level)) & SYNC_TIMER_WHEEL_MASK];
+	timer->next = *head;
+	if (timer->next)
+		timer->next->pprev = &timer->next;
+	timer->pprev = head;
+	*head = timer;
+
+	++ui16_sync_timer_wheel_pending;
+}
+
+#ifdef SYNC_TIMER_TICKLESS
+// --------------------------------------------------------------------------
+static UINT32 sync_timer_wheelNext(void)
+{
+	UINT32 ui32_tick;
+	UINT8 ui8_slot, ui8_index;
+
+	if (!ui16_sync_timer_wheel_pending)
+		return (SYNC_TIMER_TICKLESS_MAX);
+
+	// nearest non-empty slot or cascade of non-empty upper level slot
+	for (UINT32 i = 0; i < SYNC_TIMER_TICKLESS_MAX; )
+	{
+		ui32_tick = ui32_sync_timer_wheel_now + i;
+		ui8_slot = ui32_tick & SYNC_TIMER_WHEEL_MASK;
+		if ((i < SYNC_TIMER_WHEEL_SLOTS) && ap_sync_timer_wheel[0][ui8_slot])
+			return (i + 1);
+
+		for (UINT8 ui8_level = 1; !ui8_slot && (ui8_level < SYNC_TIMER_WHEEL_LEVELS); ++ui8_level)
+		{
+			ui8_index = (ui32_tick >> (SYNC_TIMER_WHEEL_BITS * ui8_level)) & SYNC_TIMER_WHEEL_MASK;
+			if (ap_sync_timer_wheel[ui8_level][ui8_index])
+				return (i + 1);
+			if (ui8_index)
+				break;
+		}
+
+		// lower level slots are empty behind current lap, only cascades are left
+		i += (i < SYNC_TIMER_WHEEL_SLOTS)?(1):(SYNC_TIMER_WHEEL_SLOTS - ui8_slot);
+	}
+
+	return (SYNC_TIMER_TICKLESS_MAX);
+}
+#endif // SYNC_TIMER_TICKLESS
+
+// --------------------------------------------------------------------------
+static VOID sync_timer_wheelUnlink(sync_timer_st *timer)
+{
+	*timer->pprev = timer->next;
+	if (timer->next)
+		timer->next->pprev = timer->pprev;
+	timer->next = NULL;
+	timer->pprev = NULL;
+
+	--ui16_sync_timer_wheel_pending;
+}
+#endif // SYNC_TIMER_WHEEL
+
+#ifdef SYNC_TIMER_TICKLESS
+// --------------------------------------------------------------------------
+static UINT32 sync_timer_sleep(UINT32 ui32_ticks)
+{
+	tick_type_t pending = ticks;
+	UINT32 ui32_elapsed;
+
+	// tick counter may be as narrow as 8 bits, elapsed ticks must not wrap it
+	if (pending >= SYNC_TIMER_TICKS_SAFE)
+		return (0);
+	if (ui32_ticks > (SYNC_TIMER_TICKS_SAFE - pending))
+		ui32_ticks = SYNC_TIMER_TICKS_SAFE - pending;
+
+	ui32_elapsed = march_syncTimerSleep(ui32_ticks);
+
+	// periodic tick is stopped, counters can be updated safely
+	ticks += ui32_elapsed;
+#ifdef SYNC_TIMER_STATS
+	sync_timer_slept += ui32_elapsed;
+#endif // SYNC_TIMER_STATS
+#ifdef SYNC_TIMER_JIFFIES
+	jiffies += ui32_elapsed;
+#endif // SYNC_TIMER_JIFFIES
+	march_syncTimerTickResume();
+
+	return (ui32_elapsed);
+}
+#endif // SYNC_TIMER_TICKLESS
+
+#if defined(SYNC_TIMER_STATS) && (SYNC_TIMER_TIMERS > 0)
+// --------------------------------------------------------------------------
+static VOID sync_timer_statsExpiry(const UINT8 ui8_timer, sync_timer_cnt_t lateness)
+{
+	sync_timer_stats_st *stats = &a_timers_stats[ui8_timer];
+	UINT8 ui8_bucket = 0;
+
+	++stats->ui32_expiries;
+	if (lateness > stats->lateness_max)
+		stats->lateness_max = lateness;
+
+	// log2 bucket, saturated counters
+	for (; lateness && (ui8_bucket < (SYNC_TIMER_STATS_BUCKETS - 1)); lateness >>= 1)
+		++ui8_bucket;
+	if (stats->aui16_lateness[ui8_bucket] != 0xFFFF)
+		++stats->aui16_lateness[ui8_bucket];
 }
+#endif // SYNC_TIMER_STATS && SYNC_TIMER_TIMERS
 
 // END
@@ -27,10 +27,46 @@
  * - SYNC_TIMER_COUNT		- additional divider for reaching desired sync times
  * - SYNC_TIMER_TIMERS		- numbers of separate timers that are used (counting 1ms)
  * 
+ * - SYNC_TIMER_COUNTER_BITS	- width of timer counters: 16 (default), 32 or 64. 16-bit counters keep running
+ * 							  state in bit 15, so periods are limited to 32767 ticks. Wider counters keep running
+ * 							  state in separate bitmap and allow long periods (hours, days).
+ * - SYNC_TIMER_JIFFIES_INIT	- initial value of jiffies (default 0), e.g. (0UL - 60000UL) makes jiffies wrap
+ * 							  one minute after start to expose wrap related errors early
+ * 
  * - SYNC_TIMER_MAINTAIN_PERIOD - if defined sync_timer tries to maintain period, otherwise
  * 								  tick count for particular timer is set to 0.
  * - SYNC_TIMER_EXT_HANDLER	- if defined additional handler defined by user is executed each time tick
  * 							  count is incremented.
+ * - SYNC_TIMER_WHEEL		- if defined timers with registered period and callback are available, see below.
+ * 							  SYNC_TIMER_TIMERS may be set to 0 when only these timers are used.
+ * - SYNC_TIMER_WHEEL_BITS	- log2 of slots per wheel level (default 6)
+ * - SYNC_TIMER_WHEEL_LEVELS	- number of wheel levels (default 4), timers further than
+ * 							  2^(SYNC_TIMER_WHEEL_BITS*SYNC_TIMER_WHEEL_LEVELS) ticks are cascaded from the last level
+ * - SYNC_TIMER_TICKLESS		- if defined syncTimerIdle() stops periodic tick and sleeps until nearest timer
+ * 							  expiry (see below)
+ * - SYNC_TIMER_TICKLESS_MAX	- longest single sleep in ticks (default 1000), sleep is additionally limited to
+ * 							  half of tick_type_t range (e.g. 127 ticks with 8-bit TICK_TYPE)
+ * - SYNC_TIMER_STATS		- if defined lateness of each legacy timer expiry (counter overshoot over value
+ * 							  checked with syncTimerGetTimer(), also with SYNC_TIMER_MAINTAIN_PERIOD) is recorded
+ * 							  in log2 histogram, together with max main loop gap between syncTimerUpdate() calls
+ * - SYNC_TIMER_STATS_BUCKETS	- number of histogram buckets (default 8)
+ * - SYNC_TIMER_US			- if defined microsecond timestamps are available (requires SYNC_TIMER_JIFFIES),
+ * 							  current tick is interpolated with march_syncTimerElapsedUs()
+ * - SYNC_TIMER_TICK_US		- length of tick in microseconds (default 1000)
+ * \note
+ * In tickless mode expiry of legacy timer is computed from value given with its latest syncTimerGetTimer()
+ * invocation, timers not checked yet do not limit sleep time. Wheel timers limit sleep to their slot or to
+ * nearest cascade. syncTimerIdle() hands sleep time to march_syncTimerSleep(), which programs compare
+ * register for wakeup, stops periodic tick and returns number of ticks elapsed until wakeup (possibly
+ * earlier due to other interrupt). Elapsed ticks are added to ticks and jiffies, so syncTimerGetTimer()
+ * semantics are kept, and march_syncTimerTickResume() restarts periodic tick. With scheduler
+ * syncTimerIdle() is typically called from syncSchedIdleHandler().
+ * \note
+ * Wheel timers (sync_timer_st) are kept in hierarchical timer wheel, storage is provided by user.
+ * Adding and cancelling timer is O(1), syncTimerUpdate() processes single slot per elapsed tick
+ * and executes callbacks only for timers that expire. Far timers are cascaded to lower levels once per
+ * wrap of lower level. Callbacks are executed from syncTimerUpdate() context and may add or cancel any timer.
+ * Wheel timers must not be accessed from interrupts.
  * \warning
  * Depending on MCU architecture additional configuration definitions may be required.
  * Implementation for particular architecture is contained in related version of library in sync_timer_march.c.
@@ -47,6 +83,7 @@ extern "C" {
  *	INCLUDES
  ***************************************************************************/
 
+#include "config.h"
 #include "ehal/global.h"
 
 
@@ -54,6 +91,44 @@ extern "C" {
  *	DEFINITIONS
  ***************************************************************************/
 
+#ifndef SYNC_TIMER_COUNTER_BITS
+#define SYNC_TIMER_COUNTER_BITS 16
+#endif // SYNC_TIMER_COUNTER_BITS
+
+#ifndef SYNC_TIMER_TICKLESS_MAX
+#define SYNC_TIMER_TICKLESS_MAX 1000
+#endif // SYNC_TIMER_TICKLESS_MAX
+
+#ifndef SYNC_TIMER_TICK_US
+#define SYNC_TIMER_TICK_US 1000UL
+#endif // SYNC_TIMER_TICK_US
+
+#ifndef SYNC_TIMER_JIFFIES_INIT
+#define SYNC_TIMER_JIFFIES_INIT 0UL
+#endif // SYNC_TIMER_JIFFIES_INIT
+
+/*!
+ * \def TIME_AFTER(a, b)
+ * \brief wrap-safe check whether 32-bit tick count a is after b
+ * \note valid when both values differ by less than 2^31 ticks
+ */
+#define TIME_AFTER(a, b) ((INT32)((UINT32)(b) - (UINT32)(a)) < 0)
+/*!
+ * \def TIME_AFTER_EQ(a, b)
+ * \brief wrap-safe check whether 32-bit tick count a is after or equal to b
+ */
+#define TIME_AFTER_EQ(a, b) ((INT32)((UINT32)(a) - (UINT32)(b)) >= 0)
+/*!
+ * \def TIME_BEFORE(a, b)
+ * \brief wrap-safe check whether 32-bit tick count a is before b
+ */
+#define TIME_BEFORE(a, b) TIME_AFTER(b, a)
+/*!
+ * \def TIME_BEFORE_EQ(a, b)
+ * \brief wrap-safe check whether 32-bit tick count a is before or equal to b
+ */
+#define TIME_BEFORE_EQ(a, b) TIME_AFTER_EQ(b, a)
+
 /*!
  * \def SYNC_TIMER_RUN_BIT
  * \brief bit in timer counter indicating whether timer started or stopped, used internally
@@ -72,6 +147,20 @@ extern "C" {
  */
 typedef TICK_TYPE tick_type_t;
 
+/*!
+ * \typedef sync_timer_cnt_t
+ * \brief timer counter type selected with SYNC_TIMER_COUNTER_BITS
+ */
+#if (SYNC_TIMER_COUNTER_BITS == 16)
+typedef UINT16 sync_timer_cnt_t;
+#elif (SYNC_TIMER_COUNTER_BITS == 32)
+typedef UINT32 sync_timer_cnt_t;
+#elif (SYNC_TIMER_COUNTER_BITS == 64)
+typedef UINT64 sync_timer_cnt_t;
+#else
+	#error "SYNC_TIMER: SYNC_TIMER_COUNTER_BITS has to be 16, 32 or 64!"
+#endif
+
 /*!
  * \var jiffies
  * \brief ticks in system specific unit (ms, us, ...)
@@ -81,20 +170,70 @@ typedef TICK_TYPE tick_type_t;
 extern volatile UINT32 jiffies;
 #endif // SYNC_TIMER_JIFFIES
 
+#ifdef SYNC_TIMER_STATS
+#ifndef SYNC_TIMER_STATS_BUCKETS
+#define SYNC_TIMER_STATS_BUCKETS 8
+#endif // SYNC_TIMER_STATS_BUCKETS
+
+/*!
+ * \struct sync_timer_stats_st
+ * \brief legacy timer lateness statistics, in ticks
+ */
+typedef struct
+{
+	UINT32 ui32_expiries;
+	sync_timer_cnt_t lateness_max;
+	// expiries late by 0, 1, 2-3, 4-7, ... ticks, last bucket collects all longer ones
+	UINT16 aui16_lateness[SYNC_TIMER_STATS_BUCKETS];
+} sync_timer_stats_st;
+#endif // SYNC_TIMER_STATS
+
+#ifdef SYNC_TIMER_WHEEL
+#ifndef SYNC_TIMER_WHEEL_BITS
+#define SYNC_TIMER_WHEEL_BITS 6
+#endif // SYNC_TIMER_WHEEL_BITS
+
+#ifndef SYNC_TIMER_WHEEL_LEVELS
+#define SYNC_TIMER_WHEEL_LEVELS 4
+#endif // SYNC_TIMER_WHEEL_LEVELS
+
+/*!
+ * \typedef sync_timer_cb_t
+ * \brief wheel timer expiration callback
+ */
+typedef VOID (*sync_timer_cb_t)(VOID *pv_arg);
+
+/*!
+ * \struct sync_timer_st
+ * \brief wheel timer, fields are used internally
+ */
+typedef struct sync_timer_s
+{
+	struct sync_timer_s *next;
+	struct sync_timer_s **pprev;
+
+	UINT32 ui32_expires;
+	UINT32 ui32_period;
+
+	sync_timer_cb_t cb;
+	VOID *pv_arg;
+} sync_timer_st;
+#endif // SYNC_TIMER_WHEEL
+
 
 /***************************************************************************
  *	FUNCTIONS
  ***************************************************************************/
 
 /*!
- * \fn syncTimerGetTimer(const UINT8 ui8_timer, const UINT16 ui16_value)
+ * \fn syncTimerGetTimer(const UINT8 ui8_timer, const sync_timer_cnt_t value)
  * \brief checks whether given timer has exceeded value (do not work for stopped timers)
  * \param ui8_timer number of timer
- * \param ui16_value value which timer counts to
+ * \param value value which timer counts to
  * \return true if timer has been exceeded, false otherwise
  * \note requires syncTimerUpdate invocation to update counters status
  */
-BOOL syncTimerGetTimer(const UINT8 ui8_timer, const UINT16 ui16_value);
+BOOL syncTimerGetTimer(const UINT8 ui8_timer, const sync_timer_cnt_t value);
 /*!
  * \fn syncTimerInit
  * \brief initializes timer for counting ticks, assigns interrupt handler
@@ -124,6 +263,126 @@ VOID syncTimerStop(const UINT8 ui8_timer);
  */
 VOID syncTimerUpdate(void);
 
+#ifdef SYNC_TIMER_WHEEL
+/*!
+ * \fn syncTimerAdd(sync_timer_st *timer, const UINT32 ui32_delay, const UINT32 ui32_period, const sync_timer_cb_t cb, VOID *pv_arg)
+ * \brief (re)starts wheel timer, pending timer is cancelled first
+ * \param timer timer storage, has to be zeroed before first use and valid until timer expires or is cancelled
+ * \param ui32_delay ticks to first expiration, 0 acts as 1
+ * \param ui32_period ticks between next expirations, 0 for one-shot timer
+ * \param cb callback executed on expiration
+ * \param pv_arg callback argument
+ */
+VOID syncTimerAdd(sync_timer_st *timer, const UINT32 ui32_delay, const UINT32 ui32_period, const sync_timer_cb_t cb, VOID *pv_arg);
+/*!
+ * \fn syncTimerCancel(sync_timer_st *timer)
+ * \brief cancels wheel timer, does nothing for timer which is not pending
+ * \param timer timer to cancel
+ */
+VOID syncTimerCancel(sync_timer_st *timer);
+/*!
+ * \fn syncTimerPending(const sync_timer_st *timer)
+ * \brief checks whether wheel timer is waiting for expiration
+ * \param timer timer to check
+ * \return true if timer is pending, false otherwise
+ */
+BOOL syncTimerPending(const sync_timer_st *timer);
+#endif // SYNC_TIMER_WHEEL
+
+#ifdef SYNC_TIMER_US
+/*!
+ * \fn syncTimerDelayUntilUs(const UINT32 ui32_deadline)
+ * \brief waits until given timestamp, timing is taken from hardware counter instead of calibrated loop
+ * \param ui32_deadline timestamp from syncTimerNowUs() plus required delay
+ * \note with SYNC_TIMER_TICKLESS whole ticks are slept with march_syncTimerSleep() and only remainder of
+ * the last tick is busy waited, otherwise whole delay is busy waited. Short delays should rather be
+ * overlapped with other work and checked with syncTimerReachedUs().
+ */
+VOID syncTimerDelayUntilUs(const UINT32 ui32_deadline);
+/*!
+ * \fn syncTimerNowUs
+ * \brief gets microsecond timestamp combined from jiffies and live hardware counter value
+ * \return timestamp, wraps every 2^32 us (compare with TIME_AFTER/TIME_BEFORE)
+ */
+UINT32 syncTimerNowUs(void);
+/*!
+ * \fn syncTimerReachedUs(const UINT32 ui32_deadline)
+ * \brief non-blocking check whether timestamp was reached
+ * \param ui32_deadline timestamp from syncTimerNowUs() plus required delay
+ * \return true if deadline was reached, false otherwise
+ */
+BOOL syncTimerReachedUs(const UINT32 ui32_deadline);
+
+/*!
+ * \fn march_syncTimerElapsedUs
+ * \brief get microseconds elapsed since last tick counted in jiffies, implemented in sync_timer_march.c
+ * \return elapsed time, SYNC_TIMER_TICK_US or more when tick interrupt is pending
+ */
+UINT32 march_syncTimerElapsedUs(void);
+#endif // SYNC_TIMER_US
+
+#ifdef SYNC_TIMER_STATS
+/*!
+ * \fn syncTimerStatsDump
+ * \brief prints statistics of all legacy timers and max loop gap to standard output
+ */
+VOID syncTimerStatsDump(void);
+/*!
+ * \fn syncTimerStatsGet(const UINT8 ui8_timer, sync_timer_stats_st *stats)
+ * \brief gets lateness statistics of given legacy timer
+ * \param ui8_timer number of timer
+ * \param stats destination of statistics
+ * \note function is unavailable if SYNC_TIMER_TIMERS is 0
+ */
+VOID syncTimerStatsGet(const UINT8 ui8_timer, sync_timer_stats_st *stats);
+/*!
+ * \fn syncTimerStatsIsrTick(const tick_type_t pending)
+ * \brief updates max loop gap while main loop is still stalled, to be called from syncTimerExtHandler()
+ * \param pending ticks not yet processed by syncTimerUpdate(), i.e. argument of syncTimerExtHandler()
+ */
+VOID syncTimerStatsIsrTick(const tick_type_t pending);
+/*!
+ * \fn syncTimerStatsLoopGapMax
+ * \brief gets longest period between syncTimerUpdate() calls, idle sleep excluded
+ * \return gap in ticks
+ */
+tick_type_t syncTimerStatsLoopGapMax(void);
+/*!
+ * \fn syncTimerStatsReset
+ * \brief clears statistics of all timers and max loop gap
+ */
+VOID syncTimerStatsReset(void);
+#endif // SYNC_TIMER_STATS
+
+#ifdef SYNC_TIMER_TICKLESS
+/*!
+ * \fn syncTimerIdle(const UINT32 ui32_limit)
+ * \brief sleeps without periodic tick until nearest timer expiry
+ * \param ui32_limit max sleep time in ticks, e.g. time to next scheduler task release
+ * \return number of ticks slept, 0 if sleep was too short to be worth stopping the tick
+ */
+UINT32 syncTimerIdle(const UINT32 ui32_limit);
+/*!
+ * \fn syncTimerNextExpiry
+ * \brief computes ticks to nearest timer expiry, including ticks not yet processed by syncTimerUpdate()
+ * \return ticks to expiry, 0 if timer is already expired, SYNC_TIMER_TICKLESS_MAX if no timer limits sleep
+ */
+UINT32 syncTimerNextExpiry(void);
+
+/*!
+ * \fn march_syncTimerSleep(const UINT32 ui32_ticks)
+ * \brief stop periodic tick, program wakeup after given ticks and sleep, implemented in sync_timer_march.c
+ * \param ui32_ticks requested sleep time
+ * \return ticks elapsed until wakeup, periodic tick stays stopped
+ */
+UINT32 march_syncTimerSleep(const UINT32 ui32_ticks);
+/*!
+ * \fn march_syncTimerTickResume
+ * \brief restart periodic tick after march_syncTimerSleep(), implemented in sync_timer_march.c
+ */
+VOID march_syncTimerTickResume(void);
+#endif // SYNC_TIMER_TICKLESS
+
 #ifdef SYNC_TIMER_EXT_HANDLER
 /*!
  * \fn syncTimerUpdate
@@ -0,0 +1,104 @@
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+
+/*!
+ * \file bench_chksum.c
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief Checksum functions - host benchmark
+ * \details
+ * Throughput of Fletcher-16 and Adler-32 compared with checksum8Bit and checksum16Bit. Blocks are limited
+ * to 32 KB, as checksum8Bit takes 16-bit length.
+ */
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#include <stdio.h>
+#include <time.h>
+
+#include "ehal/chksum/chksum.c"
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+#define BENCH_TOTAL (256UL << 20)
+#define BENCH_BUFF 32768
+
+static BYTE ac_buff[BENCH_BUFF];
+static volatile UINT32 ui32_sink;
+
+// static functions
+static double bench_nowS(void);
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+// --------------------------------------------------------------------------
+int main(void)
+{
+	static const UINT16 aui16_sizes[] = { 32, 1024, BENCH_BUFF };
+	UINT32 ui32_rounds;
+	double d_start;
+
+	for (UINT32 i = 0; i < BENCH_BUFF; ++i)
+		ac_buff[i] = i * 7;
+
+	printf("%8s %10s %10s %10s %10s  [MB/s]\n", "block", "sum8", "sum16", "fletcher16", "adler32");
+	for (UINT8 s = 0; s < sizeof(aui16_sizes) / sizeof(aui16_sizes[0]); ++s)
+	{
+		ui32_rounds = BENCH_TOTAL / aui16_sizes[s];
+		printf("%8u", aui16_sizes[s]);
+
+		// first byte depends on previous result, so calls are not merged by compiler
+		d_start = bench_nowS();
+		for (UINT32 i = 0; i < ui32_rounds; ++i)
+			ac_buff[0] = checksum8Bit(ac_buff, aui16_sizes[s]);
+		printf(" %10.1f", BENCH_TOTAL / (bench_nowS() - d_start) / 1e6);
+
+		d_start = bench_nowS();
+		for (UINT32 i = 0; i < ui32_rounds; ++i)
+			ac_buff[0] = checksum16Bit(ac_buff, aui16_sizes[s]);
+		printf(" %10.1f", BENCH_TOTAL / (bench_nowS() - d_start) / 1e6);
+
+		d_start = bench_nowS();
+		for (UINT32 i = 0; i < ui32_rounds; ++i)
+			ac_buff[0] = checksumFletcher16(ac_buff, aui16_sizes[s]);
+		printf(" %10.1f", BENCH_TOTAL / (bench_nowS() - d_start) / 1e6);
+
+		d_start = bench_nowS();
+		for (UINT32 i = 0; i < ui32_rounds; ++i)
+			ac_buff[0] = checksumAdler32(ac_buff, aui16_sizes[s]);
+		printf(" %10.1f\n", BENCH_TOTAL / (bench_nowS() - d_start) / 1e6);
+	}
+	ui32_sink = ac_buff[0];
+
+	return (0);
+}
+
+// static functions
+// --------------------------------------------------------------------------
+static double bench_nowS(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec * 1e-9);
+}
+
+// END
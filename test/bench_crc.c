@@ -0,0 +1,124 @@
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+
+/*!
+ * \file bench_crc.c
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief CRC backends - host benchmark
+ * \details
+ * Throughput of all CRCs for blocks from 16 B to 1 MB, each block continues CRC of previous one. Backend is selected at compile time, so program is
+ * built once per backend (bench_crc_<backend>, see Makefile) with CRC_BACKEND set.
+ */
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#include <stdio.h>
+#include <time.h>
+
+#include "ehal/chksum/crc.c"
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+#define BENCH_TOTAL (64UL << 20)
+#define BENCH_BUFF (1UL << 20)
+
+#if (CRC_BACKEND == CRC_BITWISE)
+	#define BENCH_BACKEND "bitwise"
+#elif (CRC_BACKEND == CRC_NIBBLE)
+	#define BENCH_BACKEND "nibble"
+#elif (CRC_BACKEND == CRC_TABLE)
+	#define BENCH_BACKEND "table"
+#elif (CRC_BACKEND == CRC_SLICE4)
+	#define BENCH_BACKEND "slice4"
+#else
+	#define BENCH_BACKEND "slice8"
+#endif
+
+static BYTE ac_buff[BENCH_BUFF];
+static volatile UINT32 ui32_sink;
+
+// static functions
+static double bench_nowS(void);
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+// --------------------------------------------------------------------------
+int main(void)
+{
+	static const UINT32 aui32_sizes[] = { 16, 256, 4096, 65536, BENCH_BUFF };
+	// bitwise backend processes much smaller amount of data
+	const UINT32 ui32_total = (CRC_BACKEND == CRC_BITWISE)?(BENCH_TOTAL / 16):(BENCH_TOTAL);
+	UINT32 ui32_rounds, ui32_crc;
+	double d_start;
+
+	for (UINT32 i = 0; i < BENCH_BUFF; ++i)
+		ac_buff[i] = i * 7;
+
+	printf("%-8s %8s %10s %10s %10s %10s  [MB/s]\n", BENCH_BACKEND, "block", "crc8", "ccitt", "modbus", "crc32");
+	for (UINT8 s = 0; s < sizeof(aui32_sizes) / sizeof(aui32_sizes[0]); ++s)
+	{
+		ui32_rounds = ui32_total / aui32_sizes[s];
+		printf("%-8s %8u", "", aui32_sizes[s]);
+
+		ui32_crc = crc8Init();
+		d_start = bench_nowS();
+		for (UINT32 i = 0; i < ui32_rounds; ++i)
+			ui32_crc = crc8Update(ui32_crc, ac_buff, aui32_sizes[s]);
+		printf(" %10.1f", ui32_total / (bench_nowS() - d_start) / 1e6);
+		ui32_sink += ui32_crc;
+
+		ui32_crc = crc16CcittInit();
+		d_start = bench_nowS();
+		for (UINT32 i = 0; i < ui32_rounds; ++i)
+			ui32_crc = crc16CcittUpdate(ui32_crc, ac_buff, aui32_sizes[s]);
+		printf(" %10.1f", ui32_total / (bench_nowS() - d_start) / 1e6);
+		ui32_sink += ui32_crc;
+
+		ui32_crc = crc16ModbusInit();
+		d_start = bench_nowS();
+		for (UINT32 i = 0; i < ui32_rounds; ++i)
+			ui32_crc = crc16ModbusUpdate(ui32_crc, ac_buff, aui32_sizes[s]);
+		printf(" %10.1f", ui32_total / (bench_nowS() - d_start) / 1e6);
+		ui32_sink += ui32_crc;
+
+		ui32_crc = crc32Init();
+		d_start = bench_nowS();
+		for (UINT32 i = 0; i < ui32_rounds; ++i)
+			ui32_crc = crc32Update(ui32_crc, ac_buff, aui32_sizes[s]);
+		printf(" %10.1f\n", ui32_total / (bench_nowS() - d_start) / 1e6);
+		ui32_sink += ui32_crc;
+	}
+
+	return (0);
+}
+
+// static functions
+// --------------------------------------------------------------------------
+static double bench_nowS(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec * 1e-9);
+}
+
+// END
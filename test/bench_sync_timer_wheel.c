@@ -0,0 +1,143 @@
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+
+/*!
+ * \file bench_sync_timer_wheel.c
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief sync_timer hierarchical wheel - host benchmark
+ * \details
+ * Cost of single tick processing with 8, 64 and 512 periodic timers. Wheel is compared with linear scan,
+ * which updates and checks every counter on each tick as legacy timers do.
+ */
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#define SYNC_TIMER_TIMERS 0
+#define SYNC_TIMER_JIFFIES
+#define SYNC_TIMER_WHEEL
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "ehal/sync_timer/sync_timer.c"
+#include "lib/sync_timer/sync_timer_march.c"
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+#define BENCH_TIMERS_MAX 512
+#define BENCH_TICKS 200000UL
+#define BENCH_PERIOD_MAX 5000
+
+static sync_timer_st a_timers[BENCH_TIMERS_MAX];
+static UINT32 aui32_periods[BENCH_TIMERS_MAX];
+static volatile UINT32 aui32_linear[BENCH_TIMERS_MAX];
+static volatile UINT32 ui32_expired;
+
+// static functions
+static VOID bench_expired(VOID *pv_arg);
+static UINT64 bench_linear(const UINT16 ui16_timers);
+static UINT64 bench_wheel(const UINT16 ui16_timers);
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+// --------------------------------------------------------------------------
+int main(void)
+{
+	static const UINT16 aui16_counts[] = { 8, 64, 512 };
+	UINT64 ui64_linear, ui64_wheel;
+	UINT32 ui32_linear_expired;
+
+	srand(1);
+	for (UINT16 i = 0; i < BENCH_TIMERS_MAX; ++i)
+		aui32_periods[i] = 1 + rand() % BENCH_PERIOD_MAX;
+
+	printf("%8s %14s %14s %10s\n", "timers", "linear ns/tick", "wheel ns/tick", "expiries");
+	for (UINT8 i = 0; i < sizeof(aui16_counts) / sizeof(aui16_counts[0]); ++i)
+	{
+		ui64_linear = bench_linear(aui16_counts[i]);
+		ui32_linear_expired = ui32_expired;
+		ui64_wheel = bench_wheel(aui16_counts[i]);
+		printf("%8u %14.1f %14.1f %10u%s\n", aui16_counts[i], (double)ui64_linear * 1000 / BENCH_TICKS,
+			(double)ui64_wheel * 1000 / BENCH_TICKS, ui32_expired, (ui32_expired == ui32_linear_expired)?"":" MISMATCH");
+	}
+
+	return (0);
+}
+
+// static functions
+// --------------------------------------------------------------------------
+static VOID bench_expired(VOID *pv_arg)
+{
+	(VOID)pv_arg;
+
+	++ui32_expired;
+}
+
+// --------------------------------------------------------------------------
+static UINT64 bench_linear(const UINT16 ui16_timers)
+{
+	UINT64 ui64_start;
+
+	for (UINT16 i = 0; i < ui16_timers; ++i)
+		aui32_linear[i] = 0;
+	ui32_expired = 0;
+
+	ui64_start = hostSyncTimerNowUs();
+	for (UINT32 t = 0; t < BENCH_TICKS; ++t)
+	{
+		for (UINT16 i = 0; i < ui16_timers; ++i)
+		{
+			if (++aui32_linear[i] >= aui32_periods[i])
+			{
+				aui32_linear[i] = 0;
+				bench_expired(NULL);
+			}
+		}
+	}
+
+	return (hostSyncTimerNowUs() - ui64_start);
+}
+
+// --------------------------------------------------------------------------
+static UINT64 bench_wheel(const UINT16 ui16_timers)
+{
+	UINT64 ui64_start;
+
+	for (UINT16 i = 0; i < ui16_timers; ++i)
+		syncTimerAdd(&a_timers[i], aui32_periods[i], aui32_periods[i], bench_expired, NULL);
+	ui32_expired = 0;
+
+	ui64_start = hostSyncTimerNowUs();
+	for (UINT32 t = 0; t < BENCH_TICKS; ++t)
+	{
+		ticks = 1;
+		syncTimerUpdate();
+	}
+	ui64_start = hostSyncTimerNowUs() - ui64_start;
+
+	for (UINT16 i = 0; i < ui16_timers; ++i)
+		syncTimerCancel(&a_timers[i]);
+
+	return (ui64_start);
+}
+
+// END
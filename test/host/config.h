@@ -0,0 +1,48 @@
+/*!
+ * \file config.h
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief Host test configuration
+ * \details
+ * Defaults shared by host tests, each test may define its own values before including tested module.
+ */
+
+#ifndef _CONFIG_H
+#define _CONFIG_H
+
+#ifndef F_CPU
+#define F_CPU 72000000UL
+#endif // F_CPU
+
+// ring, usart
+#define RING_BIG_BUFFERS
+#define USART_BIG_BUFFERS
+#ifndef USART_RBUF_SIZE
+#define USART_RBUF_SIZE 2048
+#endif // USART_RBUF_SIZE
+#ifndef USART_TBUF_SIZE
+#define USART_TBUF_SIZE 2048
+#endif // USART_TBUF_SIZE
+#ifndef USART_SEND_MAX_LENGTH
+#define USART_SEND_MAX_LENGTH 512
+#endif // USART_SEND_MAX_LENGTH
+
+// sync_timer
+#ifndef SYNC_TIMER_TIMERS
+#define SYNC_TIMER_TIMERS 8
+#endif // SYNC_TIMER_TIMERS
+
+// adc
+#ifndef ADC_SAMPLES_COUNT
+#define ADC_SAMPLES_COUNT 64
+#endif // ADC_SAMPLES_COUNT
+#ifndef ADC_CHANNELS_COUNT
+#define ADC_CHANNELS_COUNT 16
+#endif // ADC_CHANNELS_COUNT
+
+#endif // _CONFIG_H
+
+// END
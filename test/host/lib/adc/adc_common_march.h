@@ -0,0 +1,18 @@
+/*!
+ * \file adc_common_march.h
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief Host adc definitions
+ * \details
+ * Host has no adc peripheral, samples are fed by tests.
+ */
+
+#ifndef _ADC_COMMON_MARCH_H
+#define _ADC_COMMON_MARCH_H
+
+#endif // _ADC_COMMON_MARCH_H
+
+// END
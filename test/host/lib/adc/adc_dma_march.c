@@ -0,0 +1,121 @@
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+
+/*!
+ * \file adc_dma_march.c
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief Host adc_dma replay - implementation.
+ * \note
+ * For detailed description see header file.
+ */
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#include <stdio.h>
+
+#include "config.h"
+#include "ehal/adc/adc_dma.h"
+#include "lib/adc/adc_dma_march.h"
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+static UINT16 *pui16_host_adc_dma_buff = NULL;
+static UINT16 ui16_host_adc_dma_length;
+static const UINT8 *pui8_host_adc_dma_mapping;
+static UINT8 ui8_host_adc_dma_channels;
+static UINT16 ui16_host_adc_dma_pos;
+static UINT32 ui32_host_adc_dma_scan;
+
+// static functions
+static VOID host_adc_dma_complete(void);
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+// --------------------------------------------------------------------------
+VOID hostAdcDmaReplay(const host_adc_dma_source_t source, const UINT32 ui32_scans)
+{
+	if (!pui16_host_adc_dma_buff)
+		return;
+
+	for (UINT32 i = 0; i < ui32_scans; ++i, ++ui32_host_adc_dma_scan)
+	{
+		for (UINT8 ch = 0; ch < ui8_host_adc_dma_channels; ++ch)
+			pui16_host_adc_dma_buff[ui16_host_adc_dma_pos++] = source(pui8_host_adc_dma_mapping[ch], ui32_host_adc_dma_scan);
+		host_adc_dma_complete();
+	}
+}
+
+// --------------------------------------------------------------------------
+UINT32 hostAdcDmaReplayFile(const char *pc_path)
+{
+	FILE *file;
+	UINT32 ui32_scans = 0;
+
+	if (!pui16_host_adc_dma_buff || !(file = fopen(pc_path, "rb")))
+		return (0);
+
+	// scan is stored in place, buffer length is multiple of scan
+	while (pui16_host_adc_dma_buff
+		&& (ui8_host_adc_dma_channels == fread(pui16_host_adc_dma_buff + ui16_host_adc_dma_pos, sizeof(UINT16), ui8_host_adc_dma_channels, file)))
+	{
+		ui16_host_adc_dma_pos += ui8_host_adc_dma_channels;
+		++ui32_host_adc_dma_scan;
+		++ui32_scans;
+		host_adc_dma_complete();
+	}
+	fclose(file);
+
+	return (ui32_scans);
+}
+
+// --------------------------------------------------------------------------
+VOID march_adcDmaStart(UINT16 *pui16_buff, const UINT16 ui16_length, const UINT8 *pui8_mapping, const UINT8 ui8_channels)
+{
+	pui16_host_adc_dma_buff = pui16_buff;
+	ui16_host_adc_dma_length = ui16_length;
+	pui8_host_adc_dma_mapping = pui8_mapping;
+	ui8_host_adc_dma_channels = ui8_channels;
+	ui16_host_adc_dma_pos = 0;
+	ui32_host_adc_dma_scan = 0;
+}
+
+// --------------------------------------------------------------------------
+VOID march_adcDmaStop(void)
+{
+	pui16_host_adc_dma_buff = NULL;
+}
+
+// static functions
+// --------------------------------------------------------------------------
+static VOID host_adc_dma_complete(void)
+{
+	// half and full transfer complete interrupts, circular mode
+	if ((ui16_host_adc_dma_length / 2) == ui16_host_adc_dma_pos)
+		adcDmaIsrBlock(false);
+	else if (ui16_host_adc_dma_length == ui16_host_adc_dma_pos)
+	{
+		ui16_host_adc_dma_pos = 0;
+		adcDmaIsrBlock(true);
+	}
+}
+
+// END
@@ -0,0 +1,59 @@
+/*!
+ * \file adc_dma_march.h
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief Host adc_dma replay
+ * \details
+ * There is no ADC nor DMA on host. Test replays scans with hostAdcDmaReplay(), samples of each mapped
+ * hardware channel are taken from test source and stored into circular buffer the same way DMA does it.
+ * hostAdcDmaReplayFile() replays recorded file instead, which holds scans as DMA stores them: native
+ * UINT16 samples of all channels in scan order, one scan after another. adcDmaIsrBlock() is called on
+ * half and full transfer, as from DMA interrupts.
+ */
+
+#ifndef _ADC_DMA_MARCH_H
+#define _ADC_DMA_MARCH_H
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#include "ehal/adc/adc_dma.h"
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+/*!
+ * \typedef host_adc_dma_source_t
+ * \brief replayed sample of hardware channel in given scan
+ */
+typedef UINT16 (*host_adc_dma_source_t)(const UINT8 ui8_hw_channel, const UINT32 ui32_scan);
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+/*!
+ * \fn hostAdcDmaReplay(const host_adc_dma_source_t source, const UINT32 ui32_scans)
+ * \brief DMA stand-in, stores given number of scans into buffer, ignored when acquisition is stopped
+ * \param source samples source
+ * \param ui32_scans number of scans
+ */
+VOID hostAdcDmaReplay(const host_adc_dma_source_t source, const UINT32 ui32_scans);
+/*!
+ * \fn hostAdcDmaReplayFile(const char *pc_path)
+ * \brief DMA stand-in, stores all whole scans recorded in file into buffer
+ * \param pc_path file with recorded scans
+ * \return number of replayed scans, 0 if file cannot be read or acquisition is stopped
+ */
+UINT32 hostAdcDmaReplayFile(const char *pc_path);
+
+#endif // _ADC_DMA_MARCH_H
+
+// END
@@ -0,0 +1,94 @@
+/*!
+ * \file io.h
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief Host peripheral stand-ins
+ * \details
+ * Usart peripheral model used by host tests: transmission complete flag and interrupt enable bits, shift
+ * register and line record. Bytes are moved through transmitter by hostUsartTxStep() (see usart_march.h), or
+ * exchanged with pseudo-terminal by hostUsartPtyPoll(). DMA transfer is completed by hostUsartDmaTxComplete().
+ * RS422/485 transceiver driver line is modelled with b_host_rs4xx_de.
+ */
+
+#ifndef _IO_H
+#define _IO_H
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#include "ehal/global.h"
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+#define HOST_USART_LINE_SIZE 4096
+
+#define ENABLE 1
+#define DISABLE 0
+#define RESET 0
+#define SET 1
+
+#define USART_IT_TC 0x01
+#define USART_IT_TXE 0x02
+#define USART_FLAG_TC 0x01
+
+/*!
+ * \struct USART_TypeDef
+ * \brief host usart peripheral
+ */
+typedef struct
+{
+	UINT8 ui8_it;                       // enabled interrupts
+	UINT8 ui8_flags;                    // status flags
+	BOOL b_shift;                       // shift register busy
+	BYTE c_shift;                       // byte being shifted out
+	BYTE ac_line[HOST_USART_LINE_SIZE]; // bytes sent on line
+	UINT32 ui32_line;                   // number of bytes sent on line
+	UINT32 ui32_de_errors;              // bytes sent while transceiver driver was disabled
+	BOOL b_pty;                         // connected to pseudo-terminal, see hostUsartPtyPair()
+	int i_fd;                           // pseudo-terminal descriptor
+	BOOL b_rx_busy;                     // bytes received since last idle line
+	const BYTE *pc_dma;                 // DMA transfer source, NULL if DMA is idle
+	UINT16 ui16_dma_len;                // DMA transfer length
+	UINT32 ui32_dma_starts;             // DMA transfers started
+	BOOL b_isr_masked;                  // interrupts masked, see march_usartIsrMask()
+	UINT32 ui32_isr_masks;              // number of times interrupts were masked
+} USART_TypeDef;
+
+// transceiver driver enable line
+extern volatile BOOL b_host_rs4xx_de;
+#define RS4XX_TX_ENA() (b_host_rs4xx_de = true)
+#define RS4XX_TX_DIS() (b_host_rs4xx_de = false)
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+static inline VOID USART_ITConfig(USART_TypeDef *usart_if, const UINT8 ui8_it, const UINT8 ui8_state)
+{
+	if (ui8_state)
+		usart_if->ui8_it |= ui8_it;
+	else
+		usart_if->ui8_it &= ~ui8_it;
+}
+
+static inline VOID USART_ClearFlag(USART_TypeDef *usart_if, const UINT8 ui8_flag)
+{
+	usart_if->ui8_flags &= ~ui8_flag;
+}
+
+static inline UINT8 USART_GetFlagStatus(const USART_TypeDef *usart_if, const UINT8 ui8_flag)
+{
+	return ((usart_if->ui8_flags & ui8_flag)?SET:RESET);
+}
+
+#endif // _IO_H
+
+// END
@@ -0,0 +1,28 @@
+/*!
+ * \file march.h
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief Host architecture definitions
+ * \details
+ * Machine word and tick type of host build, TICK_TYPE may be overridden to test narrow tick counters.
+ */
+
+#ifndef _MARCH_H
+#define _MARCH_H
+
+#include <stdint.h>
+
+#ifndef WORD_TYPE
+#define WORD_TYPE uintptr_t
+#endif // WORD_TYPE
+
+#ifndef TICK_TYPE
+#define TICK_TYPE uint16_t
+#endif // TICK_TYPE
+
+#endif // _MARCH_H
+
+// END
@@ -0,0 +1,116 @@
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+
+/*!
+ * \file sync_timer_march.c
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief Host sync_timer clock - implementation.
+ * \note
+ * For detailed description see header file.
+ */
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#include "config.h"
+#include "ehal/sync_timer/sync_timer.h"
+#include "lib/sync_timer/sync_timer_march.h"
+
+#include <time.h>
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+host_sync_timer_stats_st host_sync_timer_stats;
+
+// monotonic time of last counted tick
+static UINT64 ui64_host_tick_us;
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+// --------------------------------------------------------------------------
+VOID syncTimerInit(void)
+{
+	ui64_host_tick_us = hostSyncTimerNowUs();
+}
+
+// --------------------------------------------------------------------------
+UINT64 hostSyncTimerNowUs(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((UINT64)ts.tv_sec * 1000000UL + ts.tv_nsec / 1000);
+}
+
+// --------------------------------------------------------------------------
+VOID hostSyncTimerTick(void)
+{
+	while ((hostSyncTimerNowUs() - ui64_host_tick_us) >= SYNC_TIMER_TICK_US)
+	{
+		ui64_host_tick_us += SYNC_TIMER_TICK_US;
+		++ticks;
+#ifdef SYNC_TIMER_JIFFIES
+		++jiffies;
+#endif // SYNC_TIMER_JIFFIES
+#ifdef SYNC_TIMER_EXT_HANDLER
+		syncTimerExtHandler(ticks);
+#endif // SYNC_TIMER_EXT_HANDLER
+	}
+}
+
+#ifdef SYNC_TIMER_US
+// --------------------------------------------------------------------------
+UINT32 march_syncTimerElapsedUs(void)
+{
+	// grows over tick length while tick is pending, as with pending interrupt on target
+	return (hostSyncTimerNowUs() - ui64_host_tick_us);
+}
+#endif // SYNC_TIMER_US
+
+#ifdef SYNC_TIMER_TICKLESS
+// --------------------------------------------------------------------------
+UINT32 march_syncTimerSleep(const UINT32 ui32_ticks)
+{
+	UINT64 ui64_wakeup = ui64_host_tick_us + (UINT64)ui32_ticks * SYNC_TIMER_TICK_US;
+	struct timespec ts = { ui64_wakeup / 1000000UL, (ui64_wakeup % 1000000UL) * 1000 };
+	UINT32 ui32_elapsed;
+
+	++host_sync_timer_stats.ui32_sleeps;
+	if (ui32_ticks > host_sync_timer_stats.ui32_sleep_max)
+		host_sync_timer_stats.ui32_sleep_max = ui32_ticks;
+
+	// compare match on tick boundary, ticks pending before sleep are included in elapsed ticks
+	clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL);
+	ui32_elapsed = (hostSyncTimerNowUs() - ui64_host_tick_us) / SYNC_TIMER_TICK_US;
+	ui64_host_tick_us += (UINT64)ui32_elapsed * SYNC_TIMER_TICK_US;
+	host_sync_timer_stats.ui32_slept += ui32_elapsed;
+
+	return (ui32_elapsed);
+}
+
+// --------------------------------------------------------------------------
+VOID march_syncTimerTickResume(void)
+{
+	// periodic tick continues from last counted tick
+}
+#endif // SYNC_TIMER_TICKLESS
+
+// END
@@ -0,0 +1,60 @@
+/*!
+ * \file sync_timer_march.h
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief Host sync_timer clock
+ * \details
+ * Ticks are derived from CLOCK_MONOTONIC. There is no tick interrupt on host, test loop calls
+ * hostSyncTimerTick() instead, which counts whole ticks elapsed since the last counted one. Tickless sleep
+ * is performed with clock_nanosleep() until requested tick boundary.
+ */
+
+#ifndef _SYNC_TIMER_MARCH_H
+#define _SYNC_TIMER_MARCH_H
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#include "ehal/sync_timer/sync_timer.h"
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+/*!
+ * \struct host_sync_timer_stats_st
+ * \brief host clock activity
+ */
+typedef struct
+{
+	UINT32 ui32_sleeps;       // march_syncTimerSleep() calls
+	UINT32 ui32_sleep_max;    // longest requested sleep in ticks
+	UINT32 ui32_slept;        // ticks slept
+} host_sync_timer_stats_st;
+
+extern host_sync_timer_stats_st host_sync_timer_stats;
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+/*!
+ * \fn hostSyncTimerNowUs
+ * \brief gets monotonic clock in microseconds
+ */
+UINT64 hostSyncTimerNowUs(void);
+/*!
+ * \fn hostSyncTimerTick
+ * \brief tick interrupt stand-in, counts whole ticks elapsed since last counted tick
+ */
+VOID hostSyncTimerTick(void);
+
+#endif // _SYNC_TIMER_MARCH_H
+
+// END
@@ -0,0 +1,259 @@
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+
+/*!
+ * \file usart_march.c
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief Host usart stand-in - implementation.
+ * \note
+ * For detailed description see header file.
+ */
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#include "config.h"
+#include "lib/io.h"
+#include "ehal/usart/usart.h"
+#include "lib/usart/usart_march.h"
+
+#include <fcntl.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <unistd.h>
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+volatile BOOL b_host_rs4xx_de = false;
+
+// static functions
+static BOOL host_usartPtyRaw(const int i_fd);
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+// --------------------------------------------------------------------------
+VOID march_usartEnableTXEInterrupt(usart_cfg_st *usart)
+{
+	USART_ITConfig((USART_TypeDef*)usart->usart_if, USART_IT_TXE, ENABLE);
+}
+
+#ifdef USART_RX_FRAMES
+// --------------------------------------------------------------------------
+VOID march_usartRxTimeoutEnable(usart_cfg_st *usart, const UINT16 ui16_timeout_bits)
+{
+	// silence is measured in HOST_USART_IDLE_MS
+	(VOID)usart;
+	(VOID)ui16_timeout_bits;
+}
+#endif // USART_RX_FRAMES
+
+#ifdef USART_STATS
+// --------------------------------------------------------------------------
+VOID march_usartIsrMask(const usart_cfg_st *usart)
+{
+	USART_TypeDef *usart_if = (USART_TypeDef*)usart->usart_if;
+
+	usart_if->b_isr_masked = true;
+	++usart_if->ui32_isr_masks;
+}
+
+// --------------------------------------------------------------------------
+VOID march_usartIsrUnmask(const usart_cfg_st *usart)
+{
+	((USART_TypeDef*)usart->usart_if)->b_isr_masked = false;
+}
+#endif // USART_STATS
+
+#ifdef USART_DMA_TX
+// --------------------------------------------------------------------------
+VOID march_usartDmaTxStart(usart_cfg_st *usart, const BYTE *pc_data, const UINT16 ui16_length)
+{
+	USART_TypeDef *usart_if = (USART_TypeDef*)usart->usart_if;
+
+	usart_if->pc_dma = pc_data;
+	usart_if->ui16_dma_len = ui16_length;
+	++usart_if->ui32_dma_starts;
+}
+
+// --------------------------------------------------------------------------
+UINT16 hostUsartDmaTxComplete(usart_cfg_st *usart)
+{
+	USART_TypeDef *usart_if = (USART_TypeDef*)usart->usart_if;
+	UINT16 ui16_length = usart_if->ui16_dma_len;
+
+	if (!usart_if->pc_dma)
+		return (0);
+
+	for (UINT16 i = 0; i < ui16_length; ++i, ++usart_if->ui32_line)
+	{
+		if (usart_if->ui32_line < HOST_USART_LINE_SIZE)
+			usart_if->ac_line[usart_if->ui32_line] = usart_if->pc_dma[i];
+	}
+	usart_if->pc_dma = NULL;
+	usart_if->ui16_dma_len = 0;
+
+	// may start next transfer
+	usartIsrDmaTxComplete(usart);
+
+	return (ui16_length);
+}
+#endif // USART_DMA_TX
+
+// --------------------------------------------------------------------------
+BOOL hostUsartPtyPair(usart_cfg_st *usart_a, usart_cfg_st *usart_b)
+{
+	USART_TypeDef *usart_if_a = (USART_TypeDef*)usart_a->usart_if;
+	USART_TypeDef *usart_if_b = (USART_TypeDef*)usart_b->usart_if;
+
+	usart_if_a->i_fd = posix_openpt(O_RDWR | O_NOCTTY | O_NONBLOCK);
+	if (usart_if_a->i_fd < 0)
+		return (false);
+	if (grantpt(usart_if_a->i_fd) || unlockpt(usart_if_a->i_fd))
+	{
+		close(usart_if_a->i_fd);
+		return (false);
+	}
+	usart_if_b->i_fd = open(ptsname(usart_if_a->i_fd), O_RDWR | O_NOCTTY | O_NONBLOCK);
+	if (usart_if_b->i_fd < 0)
+	{
+		close(usart_if_a->i_fd);
+		return (false);
+	}
+
+	// no echo or character translation, line carries binary frames
+	if (!host_usartPtyRaw(usart_if_a->i_fd) || !host_usartPtyRaw(usart_if_b->i_fd))
+	{
+		close(usart_if_a->i_fd);
+		close(usart_if_b->i_fd);
+		return (false);
+	}
+
+	usart_if_a->b_pty = true;
+	usart_if_b->b_pty = true;
+	return (true);
+}
+
+// --------------------------------------------------------------------------
+VOID hostUsartPtyPoll(usart_cfg_st *usart)
+{
+	USART_TypeDef *usart_if = (USART_TypeDef*)usart->usart_if;
+	BYTE ac_buff[256];
+	UINT16 ui16_length = 0;
+	struct pollfd pfd = { usart_if->i_fd, POLLIN, 0 };
+	ssize_t i_read;
+
+	// transmitter, whole queued data is written at once
+	if (usart_if->ui8_it & USART_IT_TXE)
+	{
+		while ((ui16_length < sizeof(ac_buff)) && usartIsrTxByte(usart, &ac_buff[ui16_length]))
+			++ui16_length;
+		if (ui16_length)
+		{
+			if (!b_host_rs4xx_de)
+				usart_if->ui32_de_errors += ui16_length;
+			if (write(usart_if->i_fd, ac_buff, ui16_length) != ui16_length)
+				abort();
+			usart_if->ui32_line += ui16_length;
+		}
+		else
+			USART_ITConfig(usart_if, USART_IT_TXE, DISABLE);
+	}
+	if (!(usart_if->ui8_it & USART_IT_TXE))
+	{
+		usart_if->ui8_flags |= USART_FLAG_TC;
+		if ((usart_if->ui8_it & USART_IT_TC) && usart->host_tc_isr)
+			usart->host_tc_isr(usart);
+	}
+
+	// receiver, idle line is reported after silence following received bytes
+	i_read = read(usart_if->i_fd, ac_buff, sizeof(ac_buff));
+	if ((i_read <= 0) && usart_if->b_rx_busy && (poll(&pfd, 1, HOST_USART_IDLE_MS) > 0))
+		i_read = read(usart_if->i_fd, ac_buff, sizeof(ac_buff));
+	if (i_read > 0)
+	{
+		for (ssize_t i = 0; i < i_read; ++i)
+			usartIsrRxByte(usart, ac_buff[i]);
+		usart_if->b_rx_busy = true;
+	}
+#ifdef USART_RX_FRAMES
+	else if (usart_if->b_rx_busy)
+	{
+		usartIsrRxIdle(usart);
+		usart_if->b_rx_busy = false;
+	}
+#endif // USART_RX_FRAMES
+}
+
+// --------------------------------------------------------------------------
+VOID hostUsartTxStep(usart_cfg_st *usart)
+{
+	USART_TypeDef *usart_if = (USART_TypeDef*)usart->usart_if;
+	BYTE c_byte;
+
+	// byte in shift register left transmitter, driver had to be enabled whole time
+	if (usart_if->b_shift)
+	{
+		if (!b_host_rs4xx_de)
+			++usart_if->ui32_de_errors;
+		if (usart_if->ui32_line < HOST_USART_LINE_SIZE)
+			usart_if->ac_line[usart_if->ui32_line] = usart_if->c_shift;
+		++usart_if->ui32_line;
+		usart_if->b_shift = false;
+	}
+
+	// transmit register empty interrupt
+	if (usart_if->ui8_it & USART_IT_TXE)
+	{
+		if (usartIsrTxByte(usart, &c_byte))
+		{
+			if (!b_host_rs4xx_de)
+				++usart_if->ui32_de_errors;
+			usart_if->c_shift = c_byte;
+			usart_if->b_shift = true;
+			USART_ClearFlag(usart_if, USART_FLAG_TC);
+		}
+		else
+			USART_ITConfig(usart_if, USART_IT_TXE, DISABLE);
+	}
+
+	// transmission complete interrupt
+	if (!usart_if->b_shift)
+	{
+		usart_if->ui8_flags |= USART_FLAG_TC;
+		if ((usart_if->ui8_it & USART_IT_TC) && usart->host_tc_isr)
+			usart->host_tc_isr(usart);
+	}
+}
+
+// static functions
+// --------------------------------------------------------------------------
+static BOOL host_usartPtyRaw(const int i_fd)
+{
+	struct termios tio;
+
+	if (tcgetattr(i_fd, &tio))
+		return (false);
+	cfmakeraw(&tio);
+	return (!tcsetattr(i_fd, TCSANOW, &tio));
+}
+
+// END
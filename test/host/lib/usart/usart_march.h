@@ -0,0 +1,106 @@
+/*!
+ * \file usart_march.h
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief Host usart definitions
+ * \details
+ * Port structure contains all fields required by optional usart features. Transmitter is driven by test
+ * with hostUsartTxStep(), each call corresponds to single character time. Alternatively two ports are connected
+ * with pseudo-terminal by hostUsartPtyPair() and served by hostUsartPtyPoll(), silence on line longer than
+ * HOST_USART_IDLE_MS is reported as idle line.
+ */
+
+#ifndef _USART_MARCH_H
+#define _USART_MARCH_H
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#include "config.h"
+#include "ehal/global.h"
+#include "ehal/ring/ring.h"
+#include "ehal/usart/usart_stats.h"
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+#define HOST_USART_IDLE_MS 2
+
+typedef ring_size_t usart_bufsize_t;
+
+/*!
+ * \struct usart_cfg_st
+ * \brief host usart port
+ */
+typedef struct usart_cfg_st_
+{
+	VOID *usart_if;
+	BYTE ac_usart_rx_buff[USART_RBUF_SIZE];
+	BYTE ac_usart_tx_buff[USART_TBUF_SIZE];
+	ring_st usart_rx_ring;
+	ring_st usart_tx_ring;
+	volatile BOOL b_usart_rx_overflow;
+#ifdef USART_STATS
+	usart_stats_st usart_stats;
+#endif // USART_STATS
+#ifdef USART_RX_FRAMES
+	volatile ring_size_t usart_rx_frame_start;
+	ring_span_st usart_rx_frames[USART_RX_FRAMES];
+	volatile UINT8 usart_rx_frame_head;
+	volatile UINT8 usart_rx_frame_tail;
+#endif // USART_RX_FRAMES
+#ifdef USART_DMA_TX
+	BOOL b_usart_tx_dma;
+	volatile UINT16 usart_tx_dma_len;
+	VOID (*usart_tx_done_cb)(VOID);
+#endif // USART_DMA_TX
+	// rs4xx
+	volatile BOOL b_rs4xx_tx_active;
+	// host transmission complete interrupt handler
+	VOID (*host_tc_isr)(struct usart_cfg_st_ *usart);
+} usart_cfg_st;
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+/*!
+ * \fn march_usartEnableTXEInterrupt(usart_cfg_st *usart)
+ * \brief enable transmit register empty interrupt
+ */
+VOID march_usartEnableTXEInterrupt(usart_cfg_st *usart);
+#ifdef USART_DMA_TX
+/*!
+ * \fn hostUsartDmaTxComplete(usart_cfg_st *usart)
+ * \brief finish running DMA transfer, bytes are put on line and DMA transfer complete handler is executed
+ * \return number of bytes transferred, 0 if DMA was idle
+ */
+UINT16 hostUsartDmaTxComplete(usart_cfg_st *usart);
+#endif // USART_DMA_TX
+/*!
+ * \fn hostUsartPtyPair(usart_cfg_st *usart_a, usart_cfg_st *usart_b)
+ * \brief connect two ports with pseudo-terminal, bytes sent by one port are received by the other one
+ * \return true on success, false if pseudo-terminal is not available
+ */
+BOOL hostUsartPtyPair(usart_cfg_st *usart_a, usart_cfg_st *usart_b);
+/*!
+ * \fn hostUsartPtyPoll(usart_cfg_st *usart)
+ * \brief write queued bytes to pseudo-terminal and receive pending ones, executes TC and idle line handlers
+ */
+VOID hostUsartPtyPoll(usart_cfg_st *usart);
+/*!
+ * \fn hostUsartTxStep(usart_cfg_st *usart)
+ * \brief advance transmitter by single character time, executes TXE and TC interrupt handlers
+ */
+VOID hostUsartTxStep(usart_cfg_st *usart);
+
+#endif // _USART_MARCH_H
+
+// END
@@ -0,0 +1,40 @@
+/*!
+ * \file lib_func_attr.h
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief Host library functions attributes
+ * \details
+ * Host build places all functions in default sections.
+ */
+
+#ifndef _LIB_FUNC_ATTR_H
+#define _LIB_FUNC_ATTR_H
+
+// chksum
+#define CHKSUM_CHECKSUM8BIT_ATTR
+#define CHKSUM_CHECKSUM16BIT_ATTR
+#define CHKSUM_FLETCHER16_ATTR
+#define CHKSUM_ADLER32_ATTR
+
+// flash
+#define FLASH_FLASHREAD_ATTR
+#define FLASH_FLASHWRITE_ATTR
+
+// usart
+#define USART_USARTCLOSE_ATTR
+#define USART_USARTINIT_ATTR
+#define USART_USARTREAD_ATTR
+#define USART_USARTREADBYTE_ATTR
+#define USART_USARTSENDBYTE_ATTR
+#define USART_USARTSENDSTRING_ATTR
+#define USART_USARTUNREADBYTES_ATTR
+
+// util
+#define UTIL_SOFTRESET_ATTR
+
+#endif // _LIB_FUNC_ATTR_H
+
+// END
@@ -0,0 +1,56 @@
+/*!
+ * \file test.h
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief Host test helpers
+ * \details
+ * Failed checks are printed with their location and counted in ui32_errors, which has to be declared by
+ * test. testResult() prints summary line and gives exit code of test.
+ */
+
+#ifndef _TEST_H
+#define _TEST_H
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#include <stdio.h>
+
+#include "ehal/global.h"
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+/*!
+ * \def TEST_CHECK(cond)
+ * \brief counts failed condition in ui32_errors and prints it
+ */
+#define TEST_CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); ++ui32_errors; } } while (0)
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+/*!
+ * \fn testResult(const char *pc_name, const UINT32 ui32_errors)
+ * \brief prints test summary
+ * \param pc_name test name
+ * \param ui32_errors number of failed checks
+ * \return exit code of test, 0 if all checks passed
+ */
+static inline int testResult(const char *pc_name, const UINT32 ui32_errors)
+{
+	printf("%s: %s\n", pc_name, (ui32_errors)?"FAILED":"ok");
+	return ((ui32_errors)?1:0);
+}
+
+#endif // _TEST_H
+
+// END
@@ -0,0 +1,85 @@
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+
+
+/*!
+ * \file test_adc_average.c
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief adc_isr running sum averaging - host test
+ * \details
+ * Samples stored with adcIsrStoreSample() at maximal depth, including full scale values, have to give the
+ * same average as brute force sum of the last ADC_SAMPLES_COUNT samples after every store.
+ */
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#define ADC_SAMPLES_COUNT 256
+#define ADC_CHANNELS_COUNT 2
+
+#include <stdlib.h>
+
+#include "ehal/adc/adc_isr.c"
+#include "test.h"
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+#define TEST_CHANNEL 1
+#define TEST_SAMPLES (3 * ADC_SAMPLES_COUNT + 17)
+
+static UINT16 aui16_input[TEST_SAMPLES];
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+// --------------------------------------------------------------------------
+int main(void)
+{
+	UINT32 ui32_errors = 0;
+	UINT32 ui32_mismatch = 0;
+	UINT32 ui32_ref;
+
+	// full scale first, so sum reaches its maximum, then random values
+	srand(16);
+	for (UINT32 i = 0; i < TEST_SAMPLES; ++i)
+		aui16_input[i] = ((i < 2 * ADC_SAMPLES_COUNT) || (rand() & 1))?(0xFFFF):(rand());
+
+	TEST_CHECK(!adcIsrResult(TEST_CHANNEL));
+	for (UINT32 i = 0; i < TEST_SAMPLES; ++i)
+	{
+		adcIsrStoreSample(TEST_CHANNEL, i & ADC_SAMPLES_COUNT_MASK, aui16_input[i]);
+
+		// samples not stored yet are zeros
+		ui32_ref = 0;
+		for (UINT32 k = 0; (k < ADC_SAMPLES_COUNT) && (k <= i); ++k)
+			ui32_ref += aui16_input[i - k];
+		ui32_mismatch += (adcIsrResult(TEST_CHANNEL) != (ui32_ref / ADC_SAMPLES_COUNT));
+		if ((ADC_SAMPLES_COUNT - 1) == i)
+			TEST_CHECK(0xFFFF == adcIsrResult(TEST_CHANNEL));
+	}
+	TEST_CHECK(!ui32_mismatch);
+
+	// other channel is not affected
+	TEST_CHECK(!adcIsrResult(0));
+
+	return (testResult("test_adc_average", ui32_errors));
+}
+
+// END
@@ -0,0 +1,165 @@
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+
+
+/*!
+ * \file test_adc_capture.c
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief adc_isr capture of timestamped samples - host test
+ * \details
+ * Capture is started and stopped by rising, falling and slope triggers, only masked channels are queued,
+ * sample limit ends capture. Samples not fitting into full ring are counted as overruns, ring is drained
+ * with adcIsrCapturePeek()/adcIsrCaptureConsume() after its indices wrapped.
+ */
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#define ADC_CAPTURE 128
+#define SYNC_TIMER_JIFFIES
+
+#include <stdio.h>
+#include <string.h>
+
+#include "ehal/ring/ring.c"
+#include "ehal/adc/adc_isr.c"
+#include "test.h"
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+#define TEST_SLOTS (ADC_CAPTURE / sizeof(adc_capture_sample_st))
+#define TEST_FLOOD 40
+
+volatile UINT32 jiffies;
+
+// channel 1 rises through 1000 on step 2 and falls to 500 on step 5
+static const UINT16 aui16_ch1[] = { 100, 900, 1000, 800, 600, 500, 400, 1200 };
+static const adc_capture_sample_st a_expected[] =
+{
+	{ 2, 1000, 1, 0 },
+	{ 2, 102, 2, 0 },
+	{ 3, 800, 1, 0 },
+	{ 3, 103, 2, 0 },
+	{ 4, 600, 1, 0 },
+	{ 4, 104, 2, 0 }
+};
+#define TEST_EXPECTED (sizeof(a_expected) / sizeof(a_expected[0]))
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+// --------------------------------------------------------------------------
+int main(void)
+{
+	UINT32 ui32_errors = 0;
+	adc_capture_sample_st a_samples[TEST_SLOTS + 1];
+	BYTE ac_drained[ADC_CAPTURE];
+	const BYTE *pc_data;
+	UINT16 ui16_count, ui16_length;
+	UINT32 ui32_drained = 0;
+	adc_trigger_st start, stop;
+
+	// rising start, falling stop, channel 0 is not captured
+	start.type = ADC_TRIGGER_RISING;
+	start.ui8_channel = 1;
+	start.ui16_level = 1000;
+	stop.type = ADC_TRIGGER_FALLING;
+	stop.ui8_channel = 1;
+	stop.ui16_level = 500;
+	adcIsrCaptureStart((1UL << 1) | (1UL << 2), &start, &stop, 0);
+	TEST_CHECK(ADC_CAPTURE_ARMED == adcIsrCaptureState());
+	for (UINT8 i = 0; i < sizeof(aui16_ch1) / sizeof(aui16_ch1[0]); ++i)
+	{
+		jiffies = i;
+		adcIsrCaptureSample(0, 7);
+		adcIsrCaptureSample(1, aui16_ch1[i]);
+		adcIsrCaptureSample(2, 100 + i);
+		if (1 == i)
+			TEST_CHECK(ADC_CAPTURE_ARMED == adcIsrCaptureState());
+	}
+	TEST_CHECK(ADC_CAPTURE_DONE == adcIsrCaptureState());
+	ui16_count = adcIsrCaptureRead(a_samples, TEST_SLOTS);
+	TEST_CHECK(TEST_EXPECTED == ui16_count);
+	for (UINT8 i = 0; (i < ui16_count) && (i < TEST_EXPECTED); ++i)
+		TEST_CHECK(!memcmp(&a_samples[i], &a_expected[i], sizeof(adc_capture_sample_st)));
+
+	// slope start, capture ends after sample limit
+	start.type = ADC_TRIGGER_SLOPE;
+	start.ui8_channel = 0;
+	start.ui16_level = 300;
+	adcIsrCaptureStart(1UL << 0, &start, NULL, 5);
+	adcIsrCaptureSample(0, 1000);
+	adcIsrCaptureSample(0, 1100);
+	adcIsrCaptureSample(0, 1300);
+	TEST_CHECK(ADC_CAPTURE_ARMED == adcIsrCaptureState());
+	adcIsrCaptureSample(0, 1700);
+	TEST_CHECK(ADC_CAPTURE_RUNNING == adcIsrCaptureState());
+	for (UINT8 i = 0; i < 10; ++i)
+		adcIsrCaptureSample(0, 1701 + i);
+	TEST_CHECK(ADC_CAPTURE_DONE == adcIsrCaptureState());
+	ui16_count = adcIsrCaptureRead(a_samples, TEST_SLOTS);
+	TEST_CHECK((5 == ui16_count) && (1700 == a_samples[0].ui16_value) && (1704 == a_samples[4].ui16_value));
+
+	// immediate start, downward slope stop
+	stop.type = ADC_TRIGGER_SLOPE;
+	stop.ui8_channel = 2;
+	stop.ui16_level = 300;
+	adcIsrCaptureStart(1UL << 2, NULL, &stop, 0);
+	TEST_CHECK(ADC_CAPTURE_RUNNING == adcIsrCaptureState());
+	adcIsrCaptureSample(2, 900);
+	adcIsrCaptureSample(2, 800);
+	adcIsrCaptureSample(2, 400);
+	adcIsrCaptureSample(2, 300);
+	TEST_CHECK(ADC_CAPTURE_DONE == adcIsrCaptureState());
+	ui16_count = adcIsrCaptureRead(a_samples, TEST_SLOTS);
+	TEST_CHECK((2 == ui16_count) && (800 == a_samples[1].ui16_value));
+
+	// full ring counts overruns, indices are moved so drained region wraps
+	adcIsrCaptureStart(1UL << 0, NULL, NULL, 0);
+	for (UINT8 i = 0; i < 3; ++i)
+		adcIsrCaptureSample(0, i);
+	TEST_CHECK(3 == adcIsrCaptureRead(a_samples, TEST_SLOTS));
+	for (UINT16 i = 0; i < TEST_FLOOD; ++i)
+		adcIsrCaptureSample(0, 1000 + i);
+	TEST_CHECK(TEST_FLOOD - TEST_SLOTS == adcIsrCaptureOverruns());
+	while ((ui16_length = adcIsrCapturePeek(&pc_data)) && (ui32_drained + ui16_length <= sizeof(ac_drained)))
+	{
+		memcpy(ac_drained + ui32_drained, pc_data, ui16_length);
+		adcIsrCaptureConsume(ui16_length);
+		ui32_drained += ui16_length;
+	}
+	TEST_CHECK(sizeof(ac_drained) == ui32_drained);
+	memcpy(a_samples, ac_drained, sizeof(ac_drained));
+	for (UINT8 i = 0; i < TEST_SLOTS; ++i)
+		TEST_CHECK((1000 + i == a_samples[i].ui16_value) && (0 == a_samples[i].ui8_channel));
+
+	// capture continues once there is room
+	adcIsrCaptureSample(0, 2000);
+	TEST_CHECK((1 == adcIsrCaptureRead(a_samples, TEST_SLOTS)) && (2000 == a_samples[0].ui16_value));
+	TEST_CHECK(TEST_FLOOD - TEST_SLOTS == adcIsrCaptureOverruns());
+
+	adcIsrCaptureStop();
+	adcIsrCaptureSample(0, 3000);
+	TEST_CHECK((ADC_CAPTURE_IDLE == adcIsrCaptureState()) && !adcIsrCaptureRead(a_samples, TEST_SLOTS));
+
+	return (testResult("test_adc_capture", ui32_errors));
+}
+
+// END
@@ -0,0 +1,150 @@
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+
+/*!
+ * \file test_adc_dma.c
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief adc_dma scan mode acquisition - host test
+ * \details
+ * Scans are replayed by DMA stand-in (see host/lib/adc/adc_dma_march.h), from test source and from recorded
+ * file. Blocks have to alternate between both halves of buffer, hold interleaved samples in mapping order
+ * and averages have to follow latest block.
+ */
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#define ADC_CHANNELS_COUNT 4
+#define ADC_DMA_BLOCK_SCANS 8
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "ehal/adc/adc_dma.c"
+#include "lib/adc/adc_dma_march.c"
+#include "test.h"
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+#define TEST_BLOCKS 5
+#define TEST_FILE_SCANS (2 * ADC_DMA_BLOCK_SCANS + 3)
+
+static UINT32 ui32_errors;
+static UINT32 ui32_blocks;
+static const UINT16 *pui16_last_block;
+
+// static functions
+static UINT16 test_source(const UINT8 ui8_hw_channel, const UINT32 ui32_scan);
+static VOID test_block(const UINT16 *pui16_block);
+static BOOL test_record(char *pc_path);
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+// --------------------------------------------------------------------------
+int main(void)
+{
+	char ac_path[] = "/tmp/test_adc_dma_XXXXXX";
+
+	for (UINT8 ch = 0; ch < ADC_CHANNELS_COUNT; ++ch)
+		adcDmaSetMapping(10 + ADC_CHANNELS_COUNT - 1 - ch, ch);
+	adcDmaStart(test_block);
+
+	// block is completed only with its last scan
+	hostAdcDmaReplay(test_source, ADC_DMA_BLOCK_SCANS - 1);
+	TEST_CHECK(!adcDmaBlocks() && !ui32_blocks);
+	hostAdcDmaReplay(test_source, 1);
+	TEST_CHECK((1 == adcDmaBlocks()) && (1 == ui32_blocks));
+
+	hostAdcDmaReplay(test_source, (TEST_BLOCKS - 1) * ADC_DMA_BLOCK_SCANS);
+	TEST_CHECK((TEST_BLOCKS == adcDmaBlocks()) && (TEST_BLOCKS == ui32_blocks));
+
+	// average of latest block: scans 0..7 add 3.5 on average, truncated
+	for (UINT8 ch = 0; ch < ADC_CHANNELS_COUNT; ++ch)
+		TEST_CHECK(adcDmaResult(ch) == (10 + ADC_CHANNELS_COUNT - 1 - ch) * 1000 + (TEST_BLOCKS - 1) * 10 + 3);
+
+	// no blocks after stop
+	adcDmaStop();
+	hostAdcDmaReplay(test_source, ADC_DMA_BLOCK_SCANS);
+	TEST_CHECK(TEST_BLOCKS == adcDmaBlocks());
+
+	// recorded scans, trailing incomplete scan is ignored
+	TEST_CHECK(test_record(ac_path));
+	ui32_blocks = 0;
+	pui16_last_block = NULL;
+	TEST_CHECK(!hostAdcDmaReplayFile(ac_path));
+	adcDmaStart(test_block);
+	TEST_CHECK(TEST_FILE_SCANS == hostAdcDmaReplayFile(ac_path));
+	TEST_CHECK((2 == adcDmaBlocks()) && (2 == ui32_blocks));
+	for (UINT8 ch = 0; ch < ADC_CHANNELS_COUNT; ++ch)
+		TEST_CHECK(adcDmaResult(ch) == (10 + ADC_CHANNELS_COUNT - 1 - ch) * 1000 + 10 + 3);
+	TEST_CHECK(!hostAdcDmaReplayFile("/nonexistent/test_adc_dma"));
+	adcDmaStop();
+	unlink(ac_path);
+
+	return (testResult("test_adc_dma", ui32_errors));
+}
+
+// static functions
+// --------------------------------------------------------------------------
+static UINT16 test_source(const UINT8 ui8_hw_channel, const UINT32 ui32_scan)
+{
+	return (ui8_hw_channel * 1000 + (ui32_scan / ADC_DMA_BLOCK_SCANS) * 10 + (ui32_scan % ADC_DMA_BLOCK_SCANS));
+}
+
+// --------------------------------------------------------------------------
+static VOID test_block(const UINT16 *pui16_block)
+{
+	// ping-pong halves
+	TEST_CHECK(pui16_block == aui16_adc_dma_buff + ((ui32_blocks & 1)?(ADC_DMA_BLOCK_SIZE):(0)));
+	TEST_CHECK(pui16_block != pui16_last_block);
+	for (UINT16 i = 0; i < ADC_DMA_BLOCK_SCANS; ++i)
+	{
+		for (UINT8 ch = 0; ch < ADC_CHANNELS_COUNT; ++ch)
+			TEST_CHECK(pui16_block[i * ADC_CHANNELS_COUNT + ch] == test_source(aui8_adc_dma_mapping[ch], ui32_blocks * ADC_DMA_BLOCK_SCANS + i));
+	}
+
+	pui16_last_block = pui16_block;
+	++ui32_blocks;
+}
+
+// --------------------------------------------------------------------------
+static BOOL test_record(char *pc_path)
+{
+	int fd = mkstemp(pc_path);
+	FILE *file;
+	UINT16 ui16_sample;
+
+	if ((fd < 0) || !(file = fdopen(fd, "wb")))
+		return (false);
+
+	// scans as stored by DMA, followed by part of next scan
+	for (UINT32 i = 0; i < TEST_FILE_SCANS * ADC_CHANNELS_COUNT + 2; ++i)
+	{
+		ui16_sample = test_source(aui8_adc_dma_mapping[i % ADC_CHANNELS_COUNT], i / ADC_CHANNELS_COUNT);
+		fwrite(&ui16_sample, sizeof(ui16_sample), 1, file);
+	}
+	fclose(file);
+
+	return (true);
+}
+
+// END
@@ -0,0 +1,165 @@
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+/*!
+ * \file test_adc_filter.c
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief adc_isr filter chain - host test
+ * \details
+ * Median stage output and rolling min/max of it are compared with brute force scan of the window for
+ * monotonic, constant and random input. Short spikes have to be removed by median, IIR stage has to follow
+ * step of input and settle exactly on new value.
+ */
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#define ADC_FILTER_MEDIAN 5
+#define ADC_FILTER_IIR_SHIFT 3
+#define ADC_FILTER_MINMAX 4
+
+#include <stdlib.h>
+
+#include "ehal/adc/adc_isr.c"
+#include "test.h"
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+#define TEST_CHANNEL 2
+#define TEST_SAMPLES 20000
+
+static UINT16 aui16_input[TEST_SAMPLES];
+static UINT16 aui16_median[TEST_SAMPLES];
+
+// static functions
+static UINT32 test_run(const UINT32 ui32_count);
+static UINT16 test_median(const UINT32 ui32_pos);
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+// --------------------------------------------------------------------------
+int main(void)
+{
+	UINT32 ui32_errors = 0;
+	UINT16 ui16_min, ui16_max, ui16_prev;
+
+	// increasing input 1..8, median lags by 2 samples: 1,1,1,2,3,4,5,6, window 4 of it: 3..6
+	for (UINT32 i = 0; i < 8; ++i)
+		aui16_input[i] = i + 1;
+	TEST_CHECK(!test_run(8));
+	adcIsrMinMax(TEST_CHANNEL, &ui16_min, &ui16_max);
+	TEST_CHECK((3 == ui16_min) && (6 == ui16_max));
+
+	for (UINT32 i = 0; i < TEST_SAMPLES; ++i)
+		aui16_input[i] = TEST_SAMPLES - i;
+	TEST_CHECK(!test_run(TEST_SAMPLES));
+
+	for (UINT32 i = 0; i < TEST_SAMPLES; ++i)
+		aui16_input[i] = 1000;
+	TEST_CHECK(!test_run(TEST_SAMPLES));
+
+	srand(1);
+	for (UINT32 i = 0; i < TEST_SAMPLES; ++i)
+		aui16_input[i] = rand() % 16;
+	TEST_CHECK(!test_run(TEST_SAMPLES));
+
+	// spikes up to 2 samples long do not reach min/max nor IIR output
+	adcIsrFilterReset(TEST_CHANNEL);
+	for (UINT32 i = 0; i < 200; ++i)
+	{
+		adcIsrFilterSample(TEST_CHANNEL, (((i % 10) == 3) || ((i % 20) == 4))?(4000):(1000));
+		adcIsrMinMax(TEST_CHANNEL, &ui16_min, &ui16_max);
+		TEST_CHECK((1000 == adcIsrFiltered(TEST_CHANNEL)) && (1000 == ui16_min) && (1000 == ui16_max));
+	}
+
+	// step response, median passes step on third sample, then output rises by 1/8 of remaining difference
+	for (UINT32 i = 0; i < 2; ++i)
+	{
+		adcIsrFilterSample(TEST_CHANNEL, 2000);
+		TEST_CHECK(1000 == adcIsrFiltered(TEST_CHANNEL));
+	}
+	adcIsrFilterSample(TEST_CHANNEL, 2000);
+	TEST_CHECK(1125 == adcIsrFiltered(TEST_CHANNEL));
+	for (UINT32 i = 0; i < 100; ++i)
+	{
+		ui16_prev = adcIsrFiltered(TEST_CHANNEL);
+		adcIsrFilterSample(TEST_CHANNEL, 2000);
+		TEST_CHECK((adcIsrFiltered(TEST_CHANNEL) >= ui16_prev) && (adcIsrFiltered(TEST_CHANNEL) <= 2000));
+	}
+	TEST_CHECK(2000 == adcIsrFiltered(TEST_CHANNEL));
+
+	return (testResult("test_adc_filter", ui32_errors));
+}
+
+// static functions
+// --------------------------------------------------------------------------
+static UINT32 test_run(const UINT32 ui32_count)
+{
+	UINT32 ui32_mismatch = 0;
+	UINT16 ui16_min, ui16_max, ui16_ref_min, ui16_ref_max;
+
+	adcIsrFilterReset(TEST_CHANNEL);
+	for (UINT32 i = 0; i < ui32_count; ++i)
+	{
+		adcIsrFilterSample(TEST_CHANNEL, aui16_input[i]);
+		adcIsrMinMax(TEST_CHANNEL, &ui16_min, &ui16_max);
+
+		// min/max follows median output
+		aui16_median[i] = test_median(i);
+		ui16_ref_min = 0xFFFF;
+		ui16_ref_max = 0;
+		for (UINT32 k = 0; (k < ADC_FILTER_MINMAX) && (k <= i); ++k)
+		{
+			if (aui16_median[i - k] < ui16_ref_min)
+				ui16_ref_min = aui16_median[i - k];
+			if (aui16_median[i - k] > ui16_ref_max)
+				ui16_ref_max = aui16_median[i - k];
+		}
+
+		ui32_mismatch += ((ui16_min != ui16_ref_min) || (ui16_max != ui16_ref_max));
+	}
+
+	return (ui32_mismatch);
+}
+
+// --------------------------------------------------------------------------
+static UINT16 test_median(const UINT32 ui32_pos)
+{
+	UINT16 aui16_window[ADC_FILTER_MEDIAN];
+	UINT16 ui16_tmp;
+
+	// window before first sample is filled with it
+	for (UINT32 k = 0; k < ADC_FILTER_MEDIAN; ++k)
+		aui16_window[k] = aui16_input[(k <= ui32_pos)?(ui32_pos - k):(0)];
+
+	for (UINT32 i = 1; i < ADC_FILTER_MEDIAN; ++i)
+	{
+		for (UINT32 k = i; k && (aui16_window[k - 1] > aui16_window[k]); --k)
+		{
+			ui16_tmp = aui16_window[k];
+			aui16_window[k] = aui16_window[k - 1];
+			aui16_window[k - 1] = ui16_tmp;
+		}
+	}
+
+	return (aui16_window[ADC_FILTER_MEDIAN / 2]);
+}
+
+// END
@@ -0,0 +1,88 @@
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+
+/*!
+ * \file test_adc_oversample.c
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief adc_isr oversampling and decimation - host test
+ * \details
+ * Decimated result has to be published exactly after 4^n samples, up to 8 extra bits (65536 samples) of
+ * 8-bit converter.
+ */
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#define ADC_OVERSAMPLING
+#define ADC_RESOLUTION_BITS 8
+
+#include <stdio.h>
+
+#include "ehal/adc/adc_isr.c"
+#include "test.h"
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+#define TEST_CHANNEL 3
+
+static UINT32 ui32_errors;
+
+// static functions
+static VOID test_bits(const UINT8 ui8_bits);
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+// --------------------------------------------------------------------------
+int main(void)
+{
+	for (UINT8 ui8_bits = 1; ui8_bits <= 8; ++ui8_bits)
+		test_bits(ui8_bits);
+
+	// 8-bit converter with 9 extra bits exceeds 16-bit result
+	TEST_CHECK(!adcIsrSetOversampling(TEST_CHANNEL, 9));
+
+	return (testResult("test_adc_oversample", ui32_errors));
+}
+
+// static functions
+// --------------------------------------------------------------------------
+static VOID test_bits(const UINT8 ui8_bits)
+{
+	const UINT32 ui32_samples = (UINT32)1 << (2 * ui8_bits);
+	UINT8 ui8_res_bits;
+
+	TEST_CHECK(adcIsrSetOversampling(TEST_CHANNEL, ui8_bits));
+
+	// input dithered between 100 and 101 gives 100.5 in extended resolution
+	for (UINT32 ui32_round = 0; ui32_round < 2; ++ui32_round)
+	{
+		for (UINT32 i = 0; i < ui32_samples; ++i)
+		{
+			if (!ui32_round && (i == ui32_samples - 1))
+				TEST_CHECK(!adcIsrOversampledResult(TEST_CHANNEL, NULL));
+			adcIsrStoreSample(TEST_CHANNEL, i % ADC_SAMPLES_COUNT, 100 + (i & 1) + ui32_round);
+		}
+		TEST_CHECK(adcIsrOversampledResult(TEST_CHANNEL, &ui8_res_bits) == (UINT16)((201 + 2 * ui32_round) << ui8_bits >> 1));
+		TEST_CHECK(ADC_RESOLUTION_BITS + ui8_bits == ui8_res_bits);
+	}
+}
+
+// END
@@ -0,0 +1,117 @@
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+
+/*!
+ * \file test_adc_window.c
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief adc_isr window comparator - host test
+ * \details
+ * Threshold crossings with hysteresis post events in order with timestamps, full queue counts overruns and
+ * keeps the oldest events, queue indices survive wrap around.
+ */
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#define ADC_WINDOW 8
+#define SYNC_TIMER_JIFFIES
+
+#include <stdio.h>
+
+#include "ehal/adc/adc_isr.c"
+#include "test.h"
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+#define TEST_CHANNEL 3
+
+volatile UINT32 jiffies;
+
+static const UINT16 aui16_input[] = { 500, 900, 1001, 1010, 995, 960, 949, 1002, 400, 99, 120, 151, 500, 500 };
+// low 100, high 1000, hysteresis 50
+static const adc_window_event_st a_expected[] =
+{
+	{ 2, 1001, TEST_CHANNEL, ADC_WINDOW_ABOVE },
+	{ 6, 949, TEST_CHANNEL, ADC_WINDOW_INSIDE },
+	{ 7, 1002, TEST_CHANNEL, ADC_WINDOW_ABOVE },
+	{ 8, 400, TEST_CHANNEL, ADC_WINDOW_INSIDE },
+	{ 9, 99, TEST_CHANNEL, ADC_WINDOW_BELOW },
+	{ 11, 151, TEST_CHANNEL, ADC_WINDOW_INSIDE }
+};
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+// --------------------------------------------------------------------------
+int main(void)
+{
+	UINT32 ui32_errors = 0;
+	adc_window_event_st event;
+	UINT32 ui32_events = 0;
+
+	adcIsrWindowSet(TEST_CHANNEL, 100, 1000, 50);
+	TEST_CHECK(ADC_WINDOW_INSIDE == adcIsrWindowState(TEST_CHANNEL));
+	for (UINT8 i = 0; i < sizeof(aui16_input) / sizeof(aui16_input[0]); ++i)
+	{
+		jiffies = i;
+		adcIsrWindowSample(TEST_CHANNEL, aui16_input[i]);
+	}
+	while (adcIsrWindowEvent(&event))
+	{
+		if (ui32_events < sizeof(a_expected) / sizeof(a_expected[0]))
+		{
+			TEST_CHECK(event.ui32_timestamp == a_expected[ui32_events].ui32_timestamp);
+			TEST_CHECK(event.ui16_value == a_expected[ui32_events].ui16_value);
+			TEST_CHECK(event.ui8_channel == a_expected[ui32_events].ui8_channel);
+			TEST_CHECK(event.ui8_state == a_expected[ui32_events].ui8_state);
+		}
+		++ui32_events;
+	}
+	TEST_CHECK(sizeof(a_expected) / sizeof(a_expected[0]) == ui32_events);
+	TEST_CHECK(!adcIsrWindowOverruns());
+
+	// 39 transitions, queue keeps the oldest ADC_WINDOW
+	for (UINT8 i = 0; i < 40; ++i)
+	{
+		jiffies = 100 + i;
+		adcIsrWindowSample(TEST_CHANNEL, (i & 1)?2000:500);
+	}
+	for (ui32_events = 0; adcIsrWindowEvent(&event); ++ui32_events)
+		TEST_CHECK(event.ui32_timestamp == 101 + ui32_events);
+	TEST_CHECK(ADC_WINDOW == ui32_events);
+	TEST_CHECK(39 - ADC_WINDOW == adcIsrWindowOverruns());
+
+	// indices wrap around, channel is above the window now
+	for (UINT32 i = 0; i < 600; ++i)
+	{
+		jiffies = 1000 + i;
+		adcIsrWindowSample(TEST_CHANNEL, (i & 1)?2000:500);
+		TEST_CHECK(adcIsrWindowEvent(&event) && (event.ui32_timestamp == jiffies));
+		TEST_CHECK(!adcIsrWindowEvent(&event));
+	}
+
+	adcIsrWindowDisable(TEST_CHANNEL);
+	adcIsrWindowSample(TEST_CHANNEL, 2000);
+	TEST_CHECK(!adcIsrWindowEvent(&event));
+
+	return (testResult("test_adc_window", ui32_errors));
+}
+
+// END
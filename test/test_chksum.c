@@ -0,0 +1,203 @@
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+
+/*!
+ * \file test_chksum.c
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief Checksum functions - host test
+ * \details
+ * checksum16Bit is compared with byte by byte sum for any alignment and length. Fletcher-16 and Adler-32
+ * are compared with straightforward reference (modulo after each byte) for single buffers and streams split
+ * into chunks. Error detection on 32-byte blocks is compared with checksum8Bit:
+ * compensating changes of two bytes and swapped bytes are never detected by additive checksum.
+ */
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ehal/chksum/chksum.c"
+#include "test.h"
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+#define TEST_BUFF (1UL << 17)
+#define TEST_ROUNDS 2000
+#define TEST_BLOCK 32
+#define TEST_ERRORS 200000UL
+
+// path of checksum16Bit, test is built also without SIMD and with AVX2 (see Makefile)
+#if defined(__AVX2__)
+	#define TEST_NAME "test_chksum (avx2)"
+#elif defined(__SSE2__)
+	#define TEST_NAME "test_chksum (sse2)"
+#else
+	#define TEST_NAME "test_chksum (word)"
+#endif
+
+static BYTE ac_buff[TEST_BUFF];
+
+// undetected errors of each checksum
+typedef struct
+{
+	UINT32 ui32_sum8;
+	UINT32 ui32_fletcher16;
+	UINT32 ui32_adler32;
+} test_missed_st;
+
+// static functions
+static UINT32 test_adler32(const BYTE *pc_ptr, UINT32 ui32_length);
+static UINT16 test_fletcher16(const BYTE *pc_ptr, UINT32 ui32_length);
+static UINT16 test_sum16(const BYTE *pc_ptr, UINT32 ui32_length);
+static VOID test_missed(test_missed_st *missed, BYTE *pc_good, BYTE *pc_bad);
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+// --------------------------------------------------------------------------
+int main(void)
+{
+	UINT32 ui32_errors = 0;
+	UINT32 ui32_mismatch = 0;
+	UINT32 ui32_offset, ui32_length, ui32_split;
+	test_missed_st compensating = { 0, 0, 0 };
+	test_missed_st swapped = { 0, 0, 0 };
+	BYTE ac_good[TEST_BLOCK], ac_bad[TEST_BLOCK];
+	BYTE c_tmp;
+	UINT8 i, j;
+
+	// check values
+	TEST_CHECK(0xC8F0 == checksumFletcher16((const BYTE*)"abcde", 5));
+	TEST_CHECK(0x11E60398UL == checksumAdler32((const BYTE*)"Wikipedia", 9));
+
+	// all ones maximize sums between reductions
+	memset(ac_buff, 0xFF, TEST_BUFF);
+	TEST_CHECK(checksumFletcher16(ac_buff, TEST_BUFF) == test_fletcher16(ac_buff, TEST_BUFF));
+	TEST_CHECK(checksumAdler32(ac_buff, TEST_BUFF) == test_adler32(ac_buff, TEST_BUFF));
+	for (UINT8 k = 0; k < 8; ++k)
+		ui32_mismatch += (checksum16Bit(ac_buff + k, TEST_BUFF - 8) != test_sum16(ac_buff + k, TEST_BUFF - 8));
+	// word lanes are folded every CHKSUM_WORD_FOLD words
+	for (UINT32 k = (CHKSUM_WORD_FOLD - 1) * sizeof(_WORD); k <= (2 * CHKSUM_WORD_FOLD + 1) * sizeof(_WORD); ++k)
+		ui32_mismatch += (checksum16Bit(ac_buff, k) != test_sum16(ac_buff, k));
+
+	srand(11);
+	for (UINT32 k = 0; k < TEST_BUFF; ++k)
+		ac_buff[k] = rand();
+	for (UINT32 k = 0; k < TEST_ROUNDS; ++k)
+	{
+		ui32_offset = rand() % 1000;
+		ui32_length = rand() % ((k & 1)?(20000):(100));
+		ui32_split = rand() % (ui32_length + 1);
+
+		ui32_mismatch += (checksum16Bit(ac_buff + ui32_offset, ui32_length) != test_sum16(ac_buff + ui32_offset, ui32_length));
+
+		ui32_mismatch += (checksumFletcher16Update(checksumFletcher16Update(CHKSUM_FLETCHER16_INIT, ac_buff + ui32_offset, ui32_split),
+			ac_buff + ui32_offset + ui32_split, ui32_length - ui32_split) != test_fletcher16(ac_buff + ui32_offset, ui32_length));
+		ui32_mismatch += (checksumAdler32Update(checksumAdler32Update(CHKSUM_ADLER32_INIT, ac_buff + ui32_offset, ui32_split),
+			ac_buff + ui32_offset + ui32_split, ui32_length - ui32_split) != test_adler32(ac_buff + ui32_offset, ui32_length));
+	}
+	TEST_CHECK(!ui32_mismatch);
+
+	// error detection
+	for (UINT32 k = 0; k < TEST_ERRORS; ++k)
+	{
+		for (i = 0; i < TEST_BLOCK; ++i)
+			ac_good[i] = rand();
+		i = rand() % TEST_BLOCK;
+		j = (i + 1 + rand() % (TEST_BLOCK - 1)) % TEST_BLOCK;
+
+		// one byte increased, other one decreased by the same value
+		c_tmp = 1 + rand() % 255;
+		memcpy(ac_bad, ac_good, TEST_BLOCK);
+		ac_bad[i] += c_tmp;
+		ac_bad[j] -= c_tmp;
+		test_missed(&compensating, ac_good, ac_bad);
+
+		// two different bytes swapped
+		if (ac_good[i] == ac_good[j])
+			ac_good[j] ^= 1;
+		memcpy(ac_bad, ac_good, TEST_BLOCK);
+		ac_bad[i] = ac_good[j];
+		ac_bad[j] = ac_good[i];
+		test_missed(&swapped, ac_good, ac_bad);
+	}
+	TEST_CHECK(TEST_ERRORS == compensating.ui32_sum8);
+	TEST_CHECK(TEST_ERRORS == swapped.ui32_sum8);
+	// Fletcher-16 misses only differences which are multiple of 255 (e.g. 0x00 vs 0xFF)
+	TEST_CHECK(compensating.ui32_fletcher16 < TEST_ERRORS / 100);
+	TEST_CHECK(swapped.ui32_fletcher16 < TEST_ERRORS / 100);
+	TEST_CHECK(!compensating.ui32_adler32);
+	TEST_CHECK(!swapped.ui32_adler32);
+
+	return (testResult(TEST_NAME, ui32_errors));
+}
+
+// static functions
+// --------------------------------------------------------------------------
+static UINT32 test_adler32(const BYTE *pc_ptr, UINT32 ui32_length)
+{
+	UINT32 ui32_a = 1, ui32_b = 0;
+
+	while (ui32_length--)
+	{
+		ui32_a = (ui32_a + *pc_ptr++) % 65521;
+		ui32_b = (ui32_b + ui32_a) % 65521;
+	}
+
+	return ((ui32_b << 16) | ui32_a);
+}
+
+// --------------------------------------------------------------------------
+static UINT16 test_fletcher16(const BYTE *pc_ptr, UINT32 ui32_length)
+{
+	UINT16 ui16_sum1 = 0, ui16_sum2 = 0;
+
+	while (ui32_length--)
+	{
+		ui16_sum1 = (ui16_sum1 + *pc_ptr++) % 255;
+		ui16_sum2 = (ui16_sum2 + ui16_sum1) % 255;
+	}
+
+	return ((ui16_sum2 << 8) | ui16_sum1);
+}
+
+// --------------------------------------------------------------------------
+static UINT16 test_sum16(const BYTE *pc_ptr, UINT32 ui32_length)
+{
+	UINT16 ui16_sum = 0;
+
+	while (ui32_length--)
+		ui16_sum += *pc_ptr++;
+
+	return (ui16_sum);
+}
+
+// --------------------------------------------------------------------------
+static VOID test_missed(test_missed_st *missed, BYTE *pc_good, BYTE *pc_bad)
+{
+	missed->ui32_sum8 += (checksum8Bit(pc_good, TEST_BLOCK) == checksum8Bit(pc_bad, TEST_BLOCK));
+	missed->ui32_fletcher16 += (checksumFletcher16(pc_good, TEST_BLOCK) == checksumFletcher16(pc_bad, TEST_BLOCK));
+	missed->ui32_adler32 += (checksumAdler32(pc_good, TEST_BLOCK) == checksumAdler32(pc_bad, TEST_BLOCK));
+}
+
+// END
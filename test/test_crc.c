@@ -0,0 +1,153 @@
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+
+/*!
+ * \file test_crc.c
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief CRC backends - host test
+ * \details
+ * Check values of "123456789" and CRCs of random buffers are compared with bitwise reference, buffers are
+ * also streamed in two and three chunks at random offsets. Backend is selected at compile time, so program
+ * is built once per backend (test_crc_<backend>, see Makefile) with CRC_BACKEND set.
+ */
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#include <stdlib.h>
+
+#include "ehal/chksum/crc.c"
+#include "test.h"
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+#define TEST_BUFF 3000
+#define TEST_ROUNDS 2000
+
+#if (CRC_BACKEND == CRC_BITWISE)
+	#define TEST_NAME "test_crc_BITWISE"
+#elif (CRC_BACKEND == CRC_NIBBLE)
+	#define TEST_NAME "test_crc_NIBBLE"
+#elif (CRC_BACKEND == CRC_TABLE)
+	#define TEST_NAME "test_crc_TABLE"
+#elif (CRC_BACKEND == CRC_SLICE4)
+	#define TEST_NAME "test_crc_SLICE4"
+#else
+	#define TEST_NAME "test_crc_SLICE8"
+#endif
+
+static BYTE ac_buff[TEST_BUFF];
+
+// static functions
+static UINT32 test_reference(const UINT8 ui8_width, const UINT32 ui32_poly, const BOOL b_reflected, UINT32 ui32_crc, const BYTE *pc_ptr, UINT32 ui32_length);
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+// --------------------------------------------------------------------------
+int main(void)
+{
+	UINT32 ui32_errors = 0;
+	UINT32 aui32_mismatch[4] = { 0 };
+	UINT32 ui32_offset, ui32_length, ui32_split1, ui32_split2;
+	const BYTE *pc_ptr;
+	UINT8 ui8_crc;
+	UINT16 ui16_ccitt, ui16_modbus;
+	UINT32 ui32_crc;
+
+	// check values
+	TEST_CHECK(0xF4 == crc8((const BYTE*)"123456789", 9));
+	TEST_CHECK(0x29B1 == crc16Ccitt((const BYTE*)"123456789", 9));
+	TEST_CHECK(0x4B37 == crc16Modbus((const BYTE*)"123456789", 9));
+	TEST_CHECK(0xCBF43926UL == crc32((const BYTE*)"123456789", 9));
+
+	// empty buffer does not change crc
+	TEST_CHECK(CRC16_CCITT_INIT == crc16CcittUpdate(crc16CcittInit(), ac_buff, 0));
+	TEST_CHECK(0 == crc32(ac_buff, 0));
+
+	srand(22);
+	for (UINT32 i = 0; i < TEST_BUFF; ++i)
+		ac_buff[i] = rand();
+
+	for (UINT32 i = 0; i < TEST_ROUNDS; ++i)
+	{
+		// odd offsets and lengths exercise unaligned head and tail of sliced backends
+		ui32_offset = rand() % 64;
+		ui32_length = rand() % ((i & 3)?64:(TEST_BUFF - 64));
+		ui32_split1 = rand() % (ui32_length + 1);
+		ui32_split2 = ui32_split1 + rand() % (ui32_length - ui32_split1 + 1);
+		pc_ptr = ac_buff + ui32_offset;
+
+		ui8_crc = crc8Update(crc8Init(), pc_ptr, ui32_split1);
+		ui8_crc = crc8Final(crc8Update(ui8_crc, pc_ptr + ui32_split1, ui32_length - ui32_split1));
+		aui32_mismatch[0] += (ui8_crc != test_reference(8, 0x07, false, CRC8_INIT, pc_ptr, ui32_length));
+		aui32_mismatch[0] += (crc8(pc_ptr, ui32_length) != ui8_crc);
+
+		ui16_ccitt = crc16CcittUpdate(crc16CcittInit(), pc_ptr, ui32_split1);
+		ui16_ccitt = crc16CcittUpdate(ui16_ccitt, pc_ptr + ui32_split1, ui32_split2 - ui32_split1);
+		ui16_ccitt = crc16CcittFinal(crc16CcittUpdate(ui16_ccitt, pc_ptr + ui32_split2, ui32_length - ui32_split2));
+		aui32_mismatch[1] += (ui16_ccitt != test_reference(16, 0x1021, false, CRC16_CCITT_INIT, pc_ptr, ui32_length));
+
+		ui16_modbus = crc16ModbusUpdate(crc16ModbusInit(), pc_ptr, ui32_split1);
+		ui16_modbus = crc16ModbusFinal(crc16ModbusUpdate(ui16_modbus, pc_ptr + ui32_split1, ui32_length - ui32_split1));
+		aui32_mismatch[2] += (ui16_modbus != test_reference(16, 0xA001, true, CRC16_MODBUS_INIT, pc_ptr, ui32_length));
+
+		ui32_crc = crc32Update(crc32Init(), pc_ptr, ui32_split1);
+		ui32_crc = crc32Update(ui32_crc, pc_ptr + ui32_split1, ui32_split2 - ui32_split1);
+		ui32_crc = crc32Final(crc32Update(ui32_crc, pc_ptr + ui32_split2, ui32_length - ui32_split2));
+		aui32_mismatch[3] += (ui32_crc != ~test_reference(32, 0xEDB88320UL, true, CRC32_INIT, pc_ptr, ui32_length));
+	}
+	TEST_CHECK(!aui32_mismatch[0]);
+	TEST_CHECK(!aui32_mismatch[1]);
+	TEST_CHECK(!aui32_mismatch[2]);
+	TEST_CHECK(!aui32_mismatch[3]);
+
+	return (testResult(TEST_NAME, ui32_errors));
+}
+
+// static functions
+// --------------------------------------------------------------------------
+static UINT32 test_reference(const UINT8 ui8_width, const UINT32 ui32_poly, const BOOL b_reflected, UINT32 ui32_crc, const BYTE *pc_ptr, UINT32 ui32_length)
+{
+	UINT32 ui32_top = (UINT32)1 << (ui8_width - 1);
+	UINT32 ui32_mask = ui32_top | (ui32_top - 1);
+
+	// bit by bit, msb first for normal and lsb first for reflected crc, without final xor
+	while (ui32_length--)
+	{
+		if (b_reflected)
+		{
+			ui32_crc ^= *pc_ptr++;
+			for (UINT8 i = 0; i < 8; ++i)
+				ui32_crc = (ui32_crc & 1)?((ui32_crc >> 1) ^ ui32_poly):(ui32_crc >> 1);
+		}
+		else
+		{
+			ui32_crc ^= (UINT32)*pc_ptr++ << (ui8_width - 8);
+			for (UINT8 i = 0; i < 8; ++i)
+				ui32_crc = (ui32_crc & ui32_top)?((ui32_crc << 1) ^ ui32_poly):(ui32_crc << 1);
+		}
+		ui32_crc &= ui32_mask;
+	}
+
+	return (ui32_crc);
+}
+
+// END
@@ -0,0 +1,118 @@
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+
+/*!
+ * \file test_crc32_hw.c
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief CRC-32 peripheral path - host test
+ * \details
+ * Software model of CRC peripheral (CRC32_HW_EMULATE) is compared with bitwise reference and selected
+ * software backend. Streams mixing short blocks (software) and long blocks (peripheral) have to give the
+ * same result as single block.
+ */
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#define CRC32_HW
+#define CRC32_HW_EMULATE
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "ehal/chksum/crc.c"
+#include "test.h"
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+#define TEST_BUFF 5000
+#define TEST_ROUNDS 3000
+
+static BYTE ac_buff[TEST_BUFF];
+
+// static functions
+static UINT32 test_reference(const BYTE *pc_ptr, UINT32 ui32_length);
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+// --------------------------------------------------------------------------
+int main(void)
+{
+	UINT32 ui32_errors = 0;
+	UINT32 ui32_mismatch = 0;
+	UINT32 ui32_offset, ui32_length, ui32_split, ui32_ref;
+	UINT32 ui32_hw, ui32_sw;
+
+	// check value
+	ui32_hw = crc32Init();
+	TEST_CHECK(march_crc32Update(&ui32_hw, (const BYTE*)"123456789", 9));
+	TEST_CHECK(0xCBF43926UL == crc32Final(ui32_hw));
+	TEST_CHECK(0xCBF43926UL == crc32((const BYTE*)"123456789", 9));
+
+	srand(9);
+	for (UINT32 i = 0; i < TEST_BUFF; ++i)
+		ac_buff[i] = rand();
+
+	for (UINT32 i = 0; i < TEST_ROUNDS; ++i)
+	{
+		ui32_offset = rand() % 100;
+		ui32_length = rand() % (TEST_BUFF - 200);
+		ui32_split = rand() % (ui32_length + 1);
+		ui32_ref = test_reference(ac_buff + ui32_offset, ui32_length);
+
+		// peripheral model alone
+		ui32_hw = crc32Init();
+		march_crc32Update(&ui32_hw, ac_buff + ui32_offset, ui32_length);
+		ui32_mismatch += (crc32Final(ui32_hw) != ui32_ref);
+
+		// two chunks, either may be short enough for software backend
+		ui32_sw = crc32Update(crc32Init(), ac_buff + ui32_offset, ui32_split);
+		ui32_sw = crc32Update(ui32_sw, ac_buff + ui32_offset + ui32_split, ui32_length - ui32_split);
+		ui32_mismatch += (crc32Final(ui32_sw) != ui32_ref);
+	}
+	TEST_CHECK(!ui32_mismatch);
+
+	// peripheral continues crc computed by software and vice versa
+	ui32_sw = crc32Update(crc32Init(), ac_buff, CRC32_HW_MIN - 1);
+	march_crc32Update(&ui32_sw, ac_buff + CRC32_HW_MIN - 1, 1000);
+	ui32_sw = crc32Update(ui32_sw, ac_buff + CRC32_HW_MIN + 999, 7);
+	TEST_CHECK(crc32Final(ui32_sw) == test_reference(ac_buff, CRC32_HW_MIN + 1006));
+
+	return (testResult("test_crc32_hw", ui32_errors));
+}
+
+// static functions
+// --------------------------------------------------------------------------
+static UINT32 test_reference(const BYTE *pc_ptr, UINT32 ui32_length)
+{
+	UINT32 ui32_crc = 0xFFFFFFFFUL;
+
+	while (ui32_length--)
+	{
+		ui32_crc ^= *pc_ptr++;
+		for (UINT8 i = 0; i < 8; ++i)
+			ui32_crc = (ui32_crc & 1)?((ui32_crc >> 1) ^ 0xEDB88320UL):(ui32_crc >> 1);
+	}
+
+	return (~ui32_crc);
+}
+
+// END
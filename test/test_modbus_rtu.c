@@ -0,0 +1,169 @@
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+/*!
+ * \file test_modbus_rtu.c
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief Modbus RTU engine - host test
+ * \details
+ * Master and slave engines exchange frames over pseudo-terminal loopback. Master polls table of requests
+ * covering all supported function codes, exception response and timeout of missing slave.
+ */
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#define USART_RX_FRAMES 8
+#define SYNC_TIMER_JIFFIES
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "ehal/ring/ring.c"
+#include "ehal/usart/usart.c"
+#include "ehal/rs4xx/rs4xx.c"
+#include "ehal/chksum/crc.c"
+#include "ehal/modbus/modbus_rtu.c"
+#include "lib/usart/usart_march.c"
+#include "lib/util/util_march.c"
+#include "test.h"
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+#define TEST_SLAVE 17
+#define TEST_TIMEOUT_MS 50
+#define TEST_DURATION_MS 2000
+
+volatile UINT32 jiffies;
+
+static USART_TypeDef usart_if_master, usart_if_slave;
+static usart_cfg_st usart_master, usart_slave;
+static modbus_rtu_st mb_master, mb_slave;
+
+// slave registers
+static UINT16 aui16_holding[16];
+static UINT16 aui16_input[4] = { 0x1234, 0x5678, 0x9ABC, 0xDEF0 };
+static const modbus_regmap_st a_regmaps[] =
+{
+	{ MODBUS_REG_HOLDING, 0, 16, aui16_holding },
+	{ MODBUS_REG_INPUT, 100, 4, aui16_input }
+};
+static UINT16 ui16_written_address, ui16_written_count;
+
+// master requests
+static UINT16 aui16_write[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+static UINT16 ui16_single = 0xA55A;
+static UINT16 aui16_read_holding[8];
+static UINT16 aui16_read_input[4];
+static UINT16 aui16_dummy[4];
+static modbus_poll_st a_polls[] =
+{
+	{ TEST_SLAVE, MODBUS_FC_WRITE_MULTIPLE_REGISTERS, 4, 8, aui16_write, 1000, MODBUS_STATUS_NONE, 0, 0 },
+	{ TEST_SLAVE, MODBUS_FC_WRITE_SINGLE_REGISTER, 15, 1, &ui16_single, 1000, MODBUS_STATUS_NONE, 0, 0 },
+	{ TEST_SLAVE, MODBUS_FC_READ_HOLDING_REGISTERS, 4, 8, aui16_read_holding, 1000, MODBUS_STATUS_NONE, 0, 0 },
+	{ TEST_SLAVE, MODBUS_FC_READ_INPUT_REGISTERS, 100, 4, aui16_read_input, 1000, MODBUS_STATUS_NONE, 0, 0 },
+	{ TEST_SLAVE, MODBUS_FC_READ_INPUT_REGISTERS, 200, 4, aui16_dummy, 1000, MODBUS_STATUS_NONE, 0, 0 },
+	{ TEST_SLAVE + 1, MODBUS_FC_READ_HOLDING_REGISTERS, 0, 4, aui16_dummy, 1000, MODBUS_STATUS_NONE, 0, 0 }
+};
+#define TEST_POLLS (sizeof(a_polls) / sizeof(a_polls[0]))
+
+// static functions
+static UINT32 test_nowMs(VOID);
+static VOID test_written(const UINT16 ui16_address, const UINT16 ui16_count);
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+// --------------------------------------------------------------------------
+int main(void)
+{
+	UINT32 ui32_errors = 0;
+	UINT32 ui32_start = test_nowMs();
+	BOOL b_done = false;
+
+	usart_master.usart_if = &usart_if_master;
+	usart_master.host_tc_isr = rs4xxIsrTxComplete;
+	usart_slave.usart_if = &usart_if_slave;
+	usart_slave.host_tc_isr = rs4xxIsrTxComplete;
+	usartFlush(&usart_master);
+	usartFlush(&usart_slave);
+	if (!hostUsartPtyPair(&usart_master, &usart_slave))
+	{
+		printf("test_modbus_rtu: pseudo-terminal not available, skipped\n");
+		return (0);
+	}
+
+	jiffies = 0;
+	modbusRtuInit(&mb_master, &usart_master, MODBUS_RTU_SILENCE_BITS);
+	modbusRtuMaster(&mb_master, a_polls, TEST_POLLS, TEST_TIMEOUT_MS);
+	modbusRtuInit(&mb_slave, &usart_slave, MODBUS_RTU_SILENCE_BITS);
+	modbusRtuSlave(&mb_slave, TEST_SLAVE, a_regmaps, sizeof(a_regmaps) / sizeof(a_regmaps[0]), test_written);
+
+	// run until every request got its result
+	while (!b_done && ((test_nowMs() - ui32_start) < TEST_DURATION_MS))
+	{
+		jiffies = test_nowMs() - ui32_start;
+		modbusRtuPoll(&mb_master);
+		hostUsartPtyPoll(&usart_master);
+		modbusRtuPoll(&mb_slave);
+		hostUsartPtyPoll(&usart_slave);
+
+		b_done = true;
+		for (UINT8 i = 0; i < TEST_POLLS; ++i)
+			if (MODBUS_STATUS_NONE == a_polls[i].status)
+				b_done = false;
+	}
+
+	TEST_CHECK(b_done);
+	TEST_CHECK(MODBUS_STATUS_OK == a_polls[0].status);
+	TEST_CHECK(!memcmp(&aui16_holding[4], aui16_write, sizeof(aui16_write)));
+	TEST_CHECK((4 == ui16_written_address) || (15 == ui16_written_address));
+	TEST_CHECK(MODBUS_STATUS_OK == a_polls[1].status);
+	TEST_CHECK((0xA55A == aui16_holding[15]) && (1 == ui16_written_count));
+	TEST_CHECK(MODBUS_STATUS_OK == a_polls[2].status);
+	TEST_CHECK(!memcmp(aui16_read_holding, aui16_write, sizeof(aui16_write)));
+	TEST_CHECK(MODBUS_STATUS_OK == a_polls[3].status);
+	TEST_CHECK(!memcmp(aui16_read_input, aui16_input, sizeof(aui16_input)));
+	TEST_CHECK((MODBUS_STATUS_EXCEPTION == a_polls[4].status) && (MODBUS_EXC_ILLEGAL_DATA_ADDRESS == a_polls[4].ui8_exception));
+	TEST_CHECK(MODBUS_STATUS_TIMEOUT == a_polls[5].status);
+	TEST_CHECK(!rs4xxTxActive(&usart_master) && !rs4xxTxActive(&usart_slave));
+	TEST_CHECK(!usart_if_master.ui32_de_errors && !usart_if_slave.ui32_de_errors);
+
+	return (testResult("test_modbus_rtu", ui32_errors));
+}
+
+// static functions
+// --------------------------------------------------------------------------
+static UINT32 test_nowMs(VOID)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1000UL + ts.tv_nsec / 1000000UL);
+}
+
+// --------------------------------------------------------------------------
+static VOID test_written(const UINT16 ui16_address, const UINT16 ui16_count)
+{
+	ui16_written_address = ui16_address;
+	ui16_written_count = ui16_count;
+}
+
+// END
@@ -0,0 +1,141 @@
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+
+/*!
+ * \file test_ring.c
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief Lock-free SPSC ring buffer - host test
+ * \details
+ * Producer thread writes counting sequence with single byte and bulk writes, consumer in main thread reads
+ * it with bulk reads, single byte reads and zero-copy peek/consume, every byte has to arrive in order.
+ * Threads may run on different cores, so hardware fence is used instead of default compiler barrier. Side
+ * making no progress yields, so test runs in reasonable time on single core too.
+ */
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#define RING_BARRIER() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+
+#include "ehal/ring/ring.c"
+#include "test.h"
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+#define TEST_BYTES 200000UL
+#define TEST_CHUNK 17
+
+static ring_st ring;
+static BYTE ac_buff[64];
+
+// static functions
+static VOID *test_producer(VOID *pv_arg);
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+// --------------------------------------------------------------------------
+int main(void)
+{
+	UINT32 ui32_errors = 0;
+	UINT32 ui32_read = 0;
+	UINT32 ui32_mismatch = 0;
+	pthread_t producer;
+	BYTE ac_tmp[23];
+	BYTE *pc_data;
+	BYTE c_byte;
+	UINT16 ui16_length;
+
+	ringInit(&ring, ac_buff, sizeof(ac_buff));
+	TEST_CHECK(ringIsEmpty(&ring) && (sizeof(ac_buff) == ringFree(&ring)));
+	if (pthread_create(&producer, NULL, test_producer, NULL))
+	{
+		printf("test_ring: thread not available, skipped\n");
+		return (0);
+	}
+
+	while (ui32_read < TEST_BYTES)
+	{
+		if (ringIsEmpty(&ring))
+			sched_yield();
+
+		switch (ui32_read % 3)
+		{
+			case 0:
+				ui16_length = ringRead(&ring, ac_tmp, sizeof(ac_tmp));
+				for (UINT16 i = 0; i < ui16_length; ++i, ++ui32_read)
+					ui32_mismatch += (ac_tmp[i] != (BYTE)ui32_read);
+				break;
+			case 1:
+				if (ringGet(&ring, &c_byte))
+					ui32_mismatch += (c_byte != (BYTE)ui32_read++);
+				break;
+			default:
+				ui16_length = ringPeek(&ring, &pc_data);
+				for (UINT16 i = 0; i < ui16_length; ++i, ++ui32_read)
+					ui32_mismatch += (pc_data[i] != (BYTE)ui32_read);
+				ringConsume(&ring, ui16_length);
+				break;
+		}
+	}
+	pthread_join(producer, NULL);
+
+	TEST_CHECK(!ui32_mismatch);
+	TEST_CHECK(ringIsEmpty(&ring));
+
+	return (testResult("test_ring", ui32_errors));
+}
+
+// static functions
+// --------------------------------------------------------------------------
+static VOID *test_producer(VOID *pv_arg)
+{
+	UINT32 ui32_written = 0;
+	BYTE ac_tmp[TEST_CHUNK];
+	UINT16 ui16_length;
+
+	(VOID)pv_arg;
+
+	while (ui32_written < TEST_BYTES)
+	{
+		if (ringIsFull(&ring))
+			sched_yield();
+
+		if (ui32_written % 3)
+		{
+			if (ringPut(&ring, (BYTE)ui32_written))
+				++ui32_written;
+			continue;
+		}
+
+		ui16_length = ((TEST_BYTES - ui32_written) < TEST_CHUNK)?(TEST_BYTES - ui32_written):(TEST_CHUNK);
+		for (UINT16 i = 0; i < ui16_length; ++i)
+			ac_tmp[i] = ui32_written + i;
+		ui32_written += ringWrite(&ring, ac_tmp, ui16_length);
+	}
+
+	return (NULL);
+}
+
+// END
@@ -0,0 +1,118 @@
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+/*!
+ * \file test_rs4xx.c
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief Interrupt driven RS422/485 handler - host test
+ * \details
+ * Transmitter is modelled character by character (see host/lib/io.h). Driver has to be enabled for every
+ * byte on line and released only from transmission complete interrupt. State of ports is independent.
+ */
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "ehal/ring/ring.c"
+#include "ehal/usart/usart.c"
+#include "ehal/rs4xx/rs4xx.c"
+#include "lib/usart/usart_march.c"
+#include "lib/util/util_march.c"
+#include "test.h"
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+static USART_TypeDef usart_if_a, usart_if_b;
+static usart_cfg_st usart_a, usart_b;
+static UINT32 ui32_errors;
+
+// static functions
+static VOID test_init(usart_cfg_st *usart, USART_TypeDef *usart_if);
+static UINT32 test_drain(usart_cfg_st *usart);
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+// --------------------------------------------------------------------------
+int main(void)
+{
+	BYTE ac_data[300];
+
+	for (UINT16 i = 0; i < sizeof(ac_data); ++i)
+		ac_data[i] = i;
+	test_init(&usart_a, &usart_if_a);
+	test_init(&usart_b, &usart_if_b);
+
+	// whole frame back to back, driver released after last byte
+	rs4xxSend(&usart_a, ac_data, sizeof(ac_data));
+	TEST_CHECK(rs4xxTxActive(&usart_a) && b_host_rs4xx_de);
+	TEST_CHECK(test_drain(&usart_a) <= sizeof(ac_data) + 2);
+	TEST_CHECK(!rs4xxTxActive(&usart_a) && !b_host_rs4xx_de);
+	TEST_CHECK((usart_if_a.ui32_line == sizeof(ac_data)) && !memcmp(usart_if_a.ac_line, ac_data, sizeof(ac_data)));
+	TEST_CHECK(!usart_if_a.ui32_de_errors);
+
+	// data queued while last byte is shifted out keeps driver enabled
+	rs4xxSendByte(&usart_a, 0x55);
+	hostUsartTxStep(&usart_a);
+	rs4xxSendString(&usart_a, (const BYTE*)"abc", 10);
+	test_drain(&usart_a);
+	TEST_CHECK(!rs4xxTxActive(&usart_a) && !b_host_rs4xx_de);
+	TEST_CHECK((usart_if_a.ui32_line == sizeof(ac_data) + 4) && !memcmp(usart_if_a.ac_line + sizeof(ac_data), "\x55" "abc", 4));
+	TEST_CHECK(!usart_if_a.ui32_de_errors);
+
+	// completion of one port does not affect other one
+	rs4xxSend(&usart_a, ac_data, 10);
+	rs4xxSend(&usart_b, ac_data, 20);
+	TEST_CHECK(rs4xxTxActive(&usart_a) && rs4xxTxActive(&usart_b));
+	test_drain(&usart_a);
+	TEST_CHECK(!rs4xxTxActive(&usart_a) && rs4xxTxActive(&usart_b));
+	test_drain(&usart_b);
+	TEST_CHECK(!rs4xxTxActive(&usart_b));
+	TEST_CHECK(usart_if_b.ui32_line == 20);
+
+	return (testResult("test_rs4xx", ui32_errors));
+}
+
+// static functions
+// --------------------------------------------------------------------------
+static VOID test_init(usart_cfg_st *usart, USART_TypeDef *usart_if)
+{
+	usart->usart_if = usart_if;
+	usart->host_tc_isr = rs4xxIsrTxComplete;
+	usartFlush(usart);
+}
+
+// --------------------------------------------------------------------------
+static UINT32 test_drain(usart_cfg_st *usart)
+{
+	UINT32 ui32_steps = 0;
+
+	while (rs4xxTxActive(usart) && (ui32_steps < 100000))
+	{
+		hostUsartTxStep(usart);
+		++ui32_steps;
+	}
+
+	return (ui32_steps);
+}
+
+// END
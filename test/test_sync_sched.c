@@ -0,0 +1,153 @@
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+/*!
+ * \file test_sync_sched.c
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief Cooperative scheduler - host test
+ * \details
+ * Periodic task overrunning its period has to be released again on its original phase, with missed releases
+ * skipped. Released tasks run in order of deadlines, priority decides between equal ones. Task re-adding
+ * itself is rescheduled with cleared statistics. Jiffies are advanced by test, including wrap around.
+ */
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#define SYNC_TIMER_JIFFIES
+
+#include <stdio.h>
+#include <string.h>
+
+#include "ehal/sync_timer/sync_sched.c"
+#include "test.h"
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+#define TEST_PERIOD 10
+
+volatile UINT32 jiffies;
+
+static sync_sched_task_st task;
+static UINT32 aui32_starts[16];
+static UINT8 ui8_starts;
+
+static sync_sched_task_st a_tasks[3];
+static char ac_order[8];
+static UINT8 ui8_order;
+
+// static functions
+static VOID test_task(VOID *pv_arg);
+static VOID test_taskOrder(VOID *pv_arg);
+static VOID test_taskReadd(VOID *pv_arg);
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+// --------------------------------------------------------------------------
+int main(void)
+{
+	UINT32 ui32_errors = 0;
+	UINT32 ui32_phase;
+
+	for (UINT8 b_wrap = 0; b_wrap < 2; ++b_wrap)
+	{
+		jiffies = (b_wrap)?(0UL - 23):3;
+		ui32_phase = jiffies + TEST_PERIOD;
+		ui8_starts = 0;
+		syncSchedAdd(&task, test_task, NULL, TEST_PERIOD, 0, 0);
+
+		for (UINT32 i = 0; i < 100; ++i, ++jiffies)
+			while (syncSchedRun())
+				;
+		syncSchedRemove(&task);
+
+		TEST_CHECK(ui8_starts > 5);
+		for (UINT8 i = 0; i < ui8_starts; ++i)
+			TEST_CHECK(!((aui32_starts[i] - ui32_phase) % TEST_PERIOD));
+		// overrun run ends 2.5 periods after its release, next one starts on third period
+		TEST_CHECK((aui32_starts[2] - aui32_starts[1]) == 3 * TEST_PERIOD);
+		// run ending exactly on release is followed immediately
+		TEST_CHECK((aui32_starts[3] - aui32_starts[2]) == TEST_PERIOD);
+		TEST_CHECK(1 == task.stats.ui32_deadline_misses);
+	}
+
+	// released together, earliest deadline first, lower priority value wins equal deadlines
+	jiffies = 0;
+	syncSchedAdd(&a_tasks[0], test_taskOrder, "A", TEST_PERIOD, 0, 0);
+	syncSchedAdd(&a_tasks[1], test_taskOrder, "B", TEST_PERIOD, 2, 3);
+	syncSchedAdd(&a_tasks[2], test_taskOrder, "C", TEST_PERIOD, 1, 3);
+	TEST_CHECK(!syncSchedRun());
+	jiffies = TEST_PERIOD;
+	while (syncSchedRun())
+		;
+	TEST_CHECK((3 == ui8_order) && !memcmp(ac_order, "CBA", 3));
+	for (UINT8 i = 0; i < 3; ++i)
+	{
+		TEST_CHECK(1 == a_tasks[i].stats.ui32_runs);
+		TEST_CHECK(!a_tasks[i].stats.ui32_lateness_max && !a_tasks[i].stats.ui32_deadline_misses);
+		syncSchedRemove(&a_tasks[i]);
+	}
+
+	// task re-adding itself keeps cleared statistics and new release
+	jiffies = 100;
+	syncSchedAdd(&task, test_taskReadd, NULL, 0, 0, 0);
+	TEST_CHECK(syncSchedRun());
+	TEST_CHECK(!task.stats.ui32_runs && !task.stats.ui32_lateness_max && !task.stats.ui32_deadline_misses);
+	TEST_CHECK(!syncSchedRun());
+	jiffies += TEST_PERIOD;
+	TEST_CHECK(syncSchedRun());
+	TEST_CHECK((1 == task.stats.ui32_runs) && !task.stats.ui32_lateness_max && !task.stats.ui32_deadline_misses);
+	syncSchedRemove(&task);
+
+	return (testResult("test_sync_sched", ui32_errors));
+}
+
+// static functions
+// --------------------------------------------------------------------------
+static VOID test_task(VOID *pv_arg)
+{
+	(VOID)pv_arg;
+
+	if (ui8_starts < sizeof(aui32_starts) / sizeof(aui32_starts[0]))
+		aui32_starts[ui8_starts++] = jiffies;
+
+	// second run overruns by 2.5 periods, third one ends exactly on next release
+	if (2 == ui8_starts)
+		jiffies += 2 * TEST_PERIOD + TEST_PERIOD / 2;
+	else if (3 == ui8_starts)
+		jiffies += TEST_PERIOD;
+}
+
+// --------------------------------------------------------------------------
+static VOID test_taskOrder(VOID *pv_arg)
+{
+	if (ui8_order < sizeof(ac_order))
+		ac_order[ui8_order++] = *(const char*)pv_arg;
+}
+
+// --------------------------------------------------------------------------
+static VOID test_taskReadd(VOID *pv_arg)
+{
+	// one-shot task turns itself into periodic one
+	if (!task.ui32_period)
+		syncSchedAdd(&task, test_taskReadd, pv_arg, TEST_PERIOD, 0, 0);
+}
+
+// END
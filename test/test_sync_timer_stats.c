@@ -0,0 +1,111 @@
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+
+
+/*!
+ * \file test_sync_timer_stats.c
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief sync_timer lateness and loop gap statistics - host test
+ * \details
+ * Lateness of legacy timer expiries is fed by test through ticks and has to land in log2 histogram buckets.
+ * Main loop stall is simulated with host clock stand-in, max loop gap has to be seen already from tick
+ * handler while loop is stalled and kept after syncTimerUpdate().
+ */
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#define SYNC_TIMER_JIFFIES
+#define SYNC_TIMER_STATS
+#define SYNC_TIMER_EXT_HANDLER
+
+#include "ehal/sync_timer/sync_timer.c"
+#include "lib/sync_timer/sync_timer_march.c"
+#include "test.h"
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+#define TEST_PERIOD 10
+#define TEST_STALL 5
+
+// overshoot of each expiry and its histogram bucket: 0, 1, 2-3, 4-7, ... 64+
+static const UINT16 aui16_late[] = { 0, 1, 3, 4, 7, 40, 200 };
+static const UINT8 aui8_bucket[] = { 0, 1, 2, 3, 3, 6, 7 };
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+// --------------------------------------------------------------------------
+int main(void)
+{
+	UINT32 ui32_errors = 0;
+	sync_timer_stats_st stats;
+	UINT64 ui64_start;
+
+	// lateness, ticks are fed directly
+	syncTimerRestart(0);
+	for (UINT8 i = 0; i < sizeof(aui16_late) / sizeof(aui16_late[0]); ++i)
+	{
+		ticks = TEST_PERIOD - 1;
+		syncTimerUpdate();
+		TEST_CHECK(!syncTimerGetTimer(0, TEST_PERIOD));
+		ticks = 1 + aui16_late[i];
+		syncTimerUpdate();
+		TEST_CHECK(syncTimerGetTimer(0, TEST_PERIOD));
+	}
+	syncTimerStatsGet(0, &stats);
+	TEST_CHECK(sizeof(aui16_late) / sizeof(aui16_late[0]) == stats.ui32_expiries);
+	TEST_CHECK(200 == stats.lateness_max);
+	for (UINT8 j = 0; j < SYNC_TIMER_STATS_BUCKETS; ++j)
+	{
+		UINT16 ui16_count = 0;
+
+		for (UINT8 i = 0; i < sizeof(aui8_bucket); ++i)
+			ui16_count += (aui8_bucket[i] == j);
+		TEST_CHECK(ui16_count == stats.aui16_lateness[j]);
+	}
+	syncTimerStatsGet(1, &stats);
+	TEST_CHECK(!stats.ui32_expiries);
+
+	// loop gap, ticks come from host clock while main loop is stalled
+	syncTimerInit();
+	syncTimerUpdate();
+	syncTimerStatsReset();
+	syncTimerStatsGet(0, &stats);
+	TEST_CHECK(!stats.ui32_expiries && !stats.lateness_max && !syncTimerStatsLoopGapMax());
+	ui64_start = hostSyncTimerNowUs();
+	while ((hostSyncTimerNowUs() - ui64_start) < (TEST_STALL + 1) * SYNC_TIMER_TICK_US)
+		hostSyncTimerTick();
+	TEST_CHECK(syncTimerStatsLoopGapMax() >= TEST_STALL);
+	syncTimerUpdate();
+	TEST_CHECK(syncTimerStatsLoopGapMax() >= TEST_STALL);
+	syncTimerStatsReset();
+	TEST_CHECK(!syncTimerStatsLoopGapMax());
+
+	return (testResult("test_sync_timer_stats", ui32_errors));
+}
+
+// --------------------------------------------------------------------------
+VOID syncTimerExtHandler(tick_type_t pending)
+{
+	syncTimerStatsIsrTick(pending);
+}
+
+// END
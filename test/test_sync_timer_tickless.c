@@ -0,0 +1,98 @@
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+/*!
+ * \file test_sync_timer_tickless.c
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief sync_timer tickless idle with 8-bit tick counter - host test
+ * \details
+ * Wheel timer far beyond 8-bit tick counter range is reached with several sleeps, each one short enough for
+ * ticks not yet processed by syncTimerUpdate() to stay within half of counter range.
+ */
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#define TICK_TYPE uint8_t
+#define SYNC_TIMER_TICK_US 100UL
+#define SYNC_TIMER_JIFFIES
+#define SYNC_TIMER_WHEEL
+#define SYNC_TIMER_TICKLESS
+
+#include <stdio.h>
+
+#include "ehal/sync_timer/sync_timer.c"
+#include "lib/sync_timer/sync_timer_march.c"
+#include "test.h"
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+#define TEST_DELAY 1000
+
+static sync_timer_st timer;
+static UINT32 ui32_fired;
+static BOOL b_fired;
+
+// static functions
+static VOID test_expired(VOID *pv_arg);
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+// --------------------------------------------------------------------------
+int main(void)
+{
+	UINT32 ui32_errors = 0;
+	UINT32 ui32_start;
+
+	syncTimerInit();
+	hostSyncTimerTick();
+	syncTimerUpdate();
+	ui32_start = jiffies;
+	syncTimerAdd(&timer, TEST_DELAY, 0, test_expired, NULL);
+
+	while (!b_fired && ((jiffies - ui32_start) < 4 * TEST_DELAY))
+	{
+		hostSyncTimerTick();
+		syncTimerUpdate();
+		if (!b_fired)
+			syncTimerIdle(0xFFFFFFFF);
+	}
+
+	TEST_CHECK(b_fired);
+	TEST_CHECK((ui32_fired - ui32_start) >= TEST_DELAY);
+	// late wakeups of host scheduler delay expiry too
+	TEST_CHECK((ui32_fired - ui32_start) <= TEST_DELAY + TEST_DELAY / 10);
+	TEST_CHECK(host_sync_timer_stats.ui32_sleeps >= (TEST_DELAY / 127));
+	TEST_CHECK(host_sync_timer_stats.ui32_sleep_max <= 127);
+
+	return (testResult("test_sync_timer_tickless", ui32_errors));
+}
+
+// static functions
+// --------------------------------------------------------------------------
+static VOID test_expired(VOID *pv_arg)
+{
+	(VOID)pv_arg;
+
+	ui32_fired = jiffies;
+	b_fired = true;
+}
+
+// END
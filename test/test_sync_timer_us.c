@@ -0,0 +1,118 @@
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+/*!
+ * \file test_sync_timer_us.c
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief sync_timer microsecond timestamps and delays - host test
+ * \details
+ * Timestamps follow host monotonic clock. Delay of many ticks is slept with periodic tick stopped and only
+ * remainder of last tick is busy waited, short delay is busy waited only.
+ */
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#define SYNC_TIMER_JIFFIES
+#define SYNC_TIMER_US
+#define SYNC_TIMER_TICKLESS
+
+#include <stdio.h>
+#include <time.h>
+
+#include "ehal/sync_timer/sync_timer.c"
+#include "lib/sync_timer/sync_timer_march.c"
+#include "test.h"
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+#define TEST_DELAY_US 20000UL
+#define TEST_SHORT_DELAY_US 130UL
+
+// static functions
+static UINT64 test_cpuUs(void);
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+// --------------------------------------------------------------------------
+int main(void)
+{
+	UINT32 ui32_errors = 0;
+	UINT32 ui32_start, ui32_prev, ui32_now;
+	UINT64 ui64_wall, ui64_cpu;
+	INT64 i64_drift;
+
+	syncTimerInit();
+
+	// timestamps are monotonic and follow host clock, whether tick is pending or counted
+	ui32_start = ui32_prev = syncTimerNowUs();
+	ui64_wall = hostSyncTimerNowUs();
+	for (UINT32 i = 0; i < 200000; ++i)
+	{
+		if (!(i & 0xFF))
+			hostSyncTimerTick();
+		ui32_now = syncTimerNowUs();
+		if (TIME_BEFORE(ui32_now, ui32_prev))
+		{
+			TEST_CHECK(TIME_AFTER_EQ(ui32_now, ui32_prev));
+			break;
+		}
+		ui32_prev = ui32_now;
+	}
+	i64_drift = (INT64)(UINT32)(syncTimerNowUs() - ui32_start) - (INT64)(hostSyncTimerNowUs() - ui64_wall);
+	TEST_CHECK(llabs(i64_drift) < 100);
+
+	// long delay, whole ticks are slept
+	hostSyncTimerTick();
+	ui64_wall = hostSyncTimerNowUs();
+	ui32_start = syncTimerNowUs();
+	ui64_cpu = test_cpuUs();
+	syncTimerDelayUntilUs(ui32_start + TEST_DELAY_US);
+	ui64_wall = hostSyncTimerNowUs() - ui64_wall;
+	ui64_cpu = test_cpuUs() - ui64_cpu;
+	TEST_CHECK(syncTimerReachedUs(ui32_start + TEST_DELAY_US));
+	TEST_CHECK(ui64_wall >= TEST_DELAY_US);
+	TEST_CHECK(host_sync_timer_stats.ui32_sleeps >= 1);
+	TEST_CHECK(host_sync_timer_stats.ui32_slept >= (TEST_DELAY_US / SYNC_TIMER_TICK_US - 2));
+	TEST_CHECK(ui64_cpu < (ui64_wall / 2));
+
+	// short delay, busy waited
+	host_sync_timer_stats.ui32_sleeps = 0;
+	ui64_wall = hostSyncTimerNowUs();
+	ui32_start = syncTimerNowUs();
+	syncTimerDelayUntilUs(ui32_start + TEST_SHORT_DELAY_US);
+	ui64_wall = hostSyncTimerNowUs() - ui64_wall;
+	TEST_CHECK(ui64_wall >= TEST_SHORT_DELAY_US);
+	TEST_CHECK(!host_sync_timer_stats.ui32_sleeps);
+
+	return (testResult("test_sync_timer_us", ui32_errors));
+}
+
+// static functions
+// --------------------------------------------------------------------------
+static UINT64 test_cpuUs(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+	return ((UINT64)ts.tv_sec * 1000000UL + ts.tv_nsec / 1000);
+}
+
+// END
@@ -0,0 +1,100 @@
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+
+/*!
+ * \file test_sync_timer_wrap.c
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief sync_timer wrap safe comparisons and wide counters - host test
+ * \details
+ * Jiffies start shortly before wrap (SYNC_TIMER_JIFFIES_INIT), deadlines are compared with TIME_AFTER family
+ * across wrap. 32-bit timer counters allow periods longer than 32767 ticks of 16-bit ones. Ticks are fed
+ * by test.
+ */
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#define SYNC_TIMER_JIFFIES
+#define SYNC_TIMER_JIFFIES_INIT (0UL - 100UL)
+#define SYNC_TIMER_COUNTER_BITS 32
+
+#include <stdio.h>
+
+#include "ehal/sync_timer/sync_timer.c"
+#include "test.h"
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+#define TEST_PERIOD 100000UL
+#define TEST_STEP 1000
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+// --------------------------------------------------------------------------
+int main(void)
+{
+	UINT32 ui32_errors = 0;
+	UINT32 ui32_deadline;
+	UINT32 ui32_elapsed = 0;
+	BOOL b_expired = false;
+
+	// comparisons across wrap
+	TEST_CHECK(0xFFFFFF9CUL == jiffies);
+	TEST_CHECK(TIME_AFTER(5UL, 0xFFFFFFF0UL) && !TIME_BEFORE(5UL, 0xFFFFFFF0UL));
+	TEST_CHECK(TIME_BEFORE(0xFFFFFFF0UL, 5UL) && !TIME_AFTER(0xFFFFFFF0UL, 5UL));
+	TEST_CHECK(TIME_AFTER_EQ(7UL, 7UL) && TIME_BEFORE_EQ(7UL, 7UL) && !TIME_AFTER(7UL, 7UL));
+	TEST_CHECK(TIME_AFTER(0x80000000UL, 1UL) && TIME_BEFORE(0x80000001UL, 1UL));
+
+	// deadline after wrap is reached only after wrap
+	ui32_deadline = jiffies + 200;
+	for (UINT32 i = 0; i < 300; ++i, ++jiffies)
+	{
+		TEST_CHECK(TIME_AFTER_EQ(jiffies, ui32_deadline) == (i >= 200));
+		TEST_CHECK(TIME_BEFORE(jiffies, ui32_deadline) == (i < 200));
+	}
+
+	// period longer than 16-bit counter range
+	syncTimerRestart(0);
+	syncTimerRestart(1);
+	syncTimerStop(1);
+	while (ui32_elapsed < 2 * TEST_PERIOD)
+	{
+		ticks = TEST_STEP;
+		syncTimerUpdate();
+		ui32_elapsed += TEST_STEP;
+
+		b_expired = syncTimerGetTimer(0, TEST_PERIOD);
+		if (b_expired)
+			break;
+	}
+	TEST_CHECK(b_expired && (TEST_PERIOD == ui32_elapsed));
+	TEST_CHECK(!syncTimerGetTimer(0, 1));
+	// stopped timer does not count
+	TEST_CHECK(!syncTimerGetTimer(1, 1));
+	syncTimerStart(1);
+	ticks = 1;
+	syncTimerUpdate();
+	TEST_CHECK(syncTimerGetTimer(1, 1));
+
+	return (testResult("test_sync_timer_wrap", ui32_errors));
+}
+
+// END
@@ -0,0 +1,110 @@
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+
+/*!
+ * \file test_usart_dma.c
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief usart DMA transmit mode - host test
+ * \details
+ * DMA transfer is completed by test (see host/lib/usart/usart_march.h). Contiguous ring segments are
+ * transferred in order, data queued during transfer is chained on completion, segment wrapping around end
+ * of ring is split and done callback is executed only when ring is drained.
+ */
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#define USART_DMA_TX
+#define USART_TBUF_SIZE 64
+#define USART_SEND_MAX_LENGTH 64
+
+#include <stdio.h>
+#include <string.h>
+
+#include "ehal/ring/ring.c"
+#include "ehal/usart/usart.c"
+#include "lib/usart/usart_march.c"
+#include "lib/util/util_march.c"
+#include "test.h"
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+static USART_TypeDef usart_if;
+static usart_cfg_st usart;
+static UINT32 ui32_done;
+
+// static functions
+static VOID test_done(VOID);
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+// --------------------------------------------------------------------------
+int main(void)
+{
+	UINT32 ui32_errors = 0;
+	BYTE ac_data[100];
+
+	for (UINT8 i = 0; i < sizeof(ac_data); ++i)
+		ac_data[i] = i;
+	usart.usart_if = &usart_if;
+	usartFlush(&usart);
+	usartSetTxDma(&usart, true, test_done);
+
+	// data queued while transfer runs is chained on its completion
+	usartSend(&usart, ac_data, 40);
+	TEST_CHECK((1 == usart_if.ui32_dma_starts) && (40 == usart_if.ui16_dma_len));
+	usartSend(&usart, ac_data + 40, 10);
+	TEST_CHECK(1 == usart_if.ui32_dma_starts);
+	TEST_CHECK(40 == hostUsartDmaTxComplete(&usart));
+	TEST_CHECK((2 == usart_if.ui32_dma_starts) && (10 == usart_if.ui16_dma_len) && !ui32_done);
+	TEST_CHECK(10 == hostUsartDmaTxComplete(&usart));
+	TEST_CHECK((1 == ui32_done) && !usart.usart_tx_dma_len && !usartUnsentBytes(&usart));
+
+	// ring wraps after 64 bytes, segment is split
+	usartSend(&usart, ac_data + 50, 40);
+	TEST_CHECK(14 == hostUsartDmaTxComplete(&usart));
+	TEST_CHECK((1 == ui32_done) && (26 == usart_if.ui16_dma_len));
+	TEST_CHECK(26 == hostUsartDmaTxComplete(&usart));
+	TEST_CHECK((2 == ui32_done) && (4 == usart_if.ui32_dma_starts));
+	TEST_CHECK(!hostUsartDmaTxComplete(&usart));
+
+	TEST_CHECK((90 == usart_if.ui32_line) && !memcmp(usart_if.ac_line, ac_data, 90));
+	TEST_CHECK(!(usart_if.ui8_it & USART_IT_TXE));
+
+	// interrupt driven mode again
+	usartSetTxDma(&usart, false, NULL);
+	usartSend(&usart, ac_data + 90, 10);
+	TEST_CHECK((4 == usart_if.ui32_dma_starts) && (usart_if.ui8_it & USART_IT_TXE));
+	for (UINT8 i = 0; i < 12; ++i)
+		hostUsartTxStep(&usart);
+	TEST_CHECK((100 == usart_if.ui32_line) && !memcmp(usart_if.ac_line, ac_data, 100));
+
+	return (testResult("test_usart_dma", ui32_errors));
+}
+
+// static functions
+// --------------------------------------------------------------------------
+static VOID test_done(VOID)
+{
+	++ui32_done;
+}
+
+// END
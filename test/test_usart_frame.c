@@ -0,0 +1,206 @@
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+
+/*!
+ * \file test_usart_frame.c
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief usart COBS/SLIP framing - host test
+ * \details
+ * Payloads are encoded into tx ring, taken back as tx interrupt would do and fed to decoder one byte at a
+ * time. Exactly the last byte has to complete frame, with payload equal to the sent one. Covered are empty
+ * frame, COBS runs at and over 254 non-zero bytes, trailing zeros, SLIP escaping, corrupted frames and
+ * frames received from rx ring.
+ */
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ehal/ring/ring.c"
+#include "ehal/usart/usart.c"
+#include "ehal/usart/usart_frame.c"
+#include "lib/usart/usart_march.c"
+#include "lib/util/util_march.c"
+#include "test.h"
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+#define TEST_BUFF 1024
+
+static USART_TypeDef usart_if;
+static usart_cfg_st usart;
+
+static BYTE ac_payload[TEST_BUFF];
+static BYTE ac_encoded[2 * TEST_BUFF + 4];
+static BYTE ac_decoded[TEST_BUFF];
+
+// static functions
+static UINT16 test_encode(const e_usartframe_type_t type, const BYTE *pc_data, const UINT16 ui16_length);
+static BOOL test_roundTrip(const e_usartframe_type_t type, const BYTE *pc_data, const UINT16 ui16_length);
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+// --------------------------------------------------------------------------
+int main(void)
+{
+	UINT32 ui32_errors = 0;
+	usart_frame_dec_st dec;
+	UINT16 ui16_length;
+
+	usart.usart_if = &usart_if;
+	usartFlush(&usart);
+
+	for (e_usartframe_type_t type = USART_FRAME_COBS; type <= USART_FRAME_SLIP; ++type)
+	{
+		// runs of non-zero bytes shorter, equal and longer than single COBS block
+		for (UINT16 i = 0; i < 600; ++i)
+			ac_payload[i] = 1 + (i % 255);
+		TEST_CHECK(test_roundTrip(type, ac_payload, 1));
+		TEST_CHECK(test_roundTrip(type, ac_payload, 253));
+		TEST_CHECK(test_roundTrip(type, ac_payload, 254));
+		TEST_CHECK(test_roundTrip(type, ac_payload, 255));
+		TEST_CHECK(test_roundTrip(type, ac_payload, 508));
+		TEST_CHECK(test_roundTrip(type, ac_payload, 509));
+
+		// zero right after full block, trailing and only zeros
+		ac_payload[254] = 0x00;
+		TEST_CHECK(test_roundTrip(type, ac_payload, 255));
+		TEST_CHECK(test_roundTrip(type, ac_payload, 256));
+		TEST_CHECK(test_roundTrip(type, (const BYTE*)"\x01\x02\x00\x00", 4));
+		TEST_CHECK(test_roundTrip(type, (const BYTE*)"\x00", 1));
+		TEST_CHECK(test_roundTrip(type, (const BYTE*)"\x00\x00\x00\x00\x00", 5));
+
+		// delimiters and escapes of the other framing as payload
+		TEST_CHECK(test_roundTrip(type, (const BYTE*)"\xC0\xDB\xDC\xDD\xDB\xC0\xC0", 7));
+
+		srand(6 + type);
+		for (UINT16 i = 0; i < 100; ++i)
+		{
+			ui16_length = rand() % TEST_BUFF;
+			for (UINT16 j = 0; j < ui16_length; ++j)
+				ac_payload[j] = (rand() & 1)?(rand() % 4):(0xC0 + rand() % 32);
+			TEST_CHECK(test_roundTrip(type, ac_payload, ui16_length));
+		}
+	}
+
+	// COBS empty frame is delivered, code byte 0xFF does not append zero
+	TEST_CHECK(test_roundTrip(USART_FRAME_COBS, ac_payload, 0));
+	TEST_CHECK((2 == test_encode(USART_FRAME_COBS, ac_payload, 0)) && !memcmp(ac_encoded, "\x01\x00", 2));
+	memset(ac_payload, 0x11, 255);
+	TEST_CHECK(258 == test_encode(USART_FRAME_COBS, ac_payload, 255));
+	TEST_CHECK((0xFF == ac_encoded[0]) && (0x02 == ac_encoded[255]) && (0x11 == ac_encoded[256]) && (0x00 == ac_encoded[257]));
+	TEST_CHECK(256 == test_encode(USART_FRAME_COBS, ac_payload, 254));
+	TEST_CHECK((0xFF == ac_encoded[0]) && (0x00 == ac_encoded[255]));
+
+	// SLIP empty frame is only delimiters, it is not told apart from resynchronization
+	TEST_CHECK((2 == test_encode(USART_FRAME_SLIP, ac_payload, 0)) && !memcmp(ac_encoded, "\xC0\xC0", 2));
+	usartFrameDecoderInit(&dec, USART_FRAME_SLIP, ac_decoded, sizeof(ac_decoded));
+	TEST_CHECK(USART_FRAME_PENDING == usartFrameDecodeByte(&dec, ac_encoded[0]));
+	TEST_CHECK(USART_FRAME_PENDING == usartFrameDecodeByte(&dec, ac_encoded[1]));
+	TEST_CHECK((7 == test_encode(USART_FRAME_SLIP, (const BYTE*)"\xC0\xDB\x01", 3))
+		&& !memcmp(ac_encoded, "\xC0\xDB\xDC\xDB\xDD\x01\xC0", 7));
+
+	// corrupted frames are dropped, next frame is decoded
+	usartFrameDecoderInit(&dec, USART_FRAME_SLIP, ac_decoded, sizeof(ac_decoded));
+	usartFrameDecodeByte(&dec, USART_FRAME_SLIP_END);
+	usartFrameDecodeByte(&dec, USART_FRAME_SLIP_ESC);
+	usartFrameDecodeByte(&dec, 0x01);
+	TEST_CHECK(USART_FRAME_ERROR == usartFrameDecodeByte(&dec, USART_FRAME_SLIP_END));
+	usartFrameDecodeByte(&dec, 0x02);
+	TEST_CHECK((USART_FRAME_READY == usartFrameDecodeByte(&dec, USART_FRAME_SLIP_END)) && (1 == dec.ui16_length) && (0x02 == ac_decoded[0]));
+
+	usartFrameDecoderInit(&dec, USART_FRAME_COBS, ac_decoded, sizeof(ac_decoded));
+	usartFrameDecodeByte(&dec, 0x05);
+	usartFrameDecodeByte(&dec, 0x01);
+	TEST_CHECK(USART_FRAME_ERROR == usartFrameDecodeByte(&dec, USART_FRAME_COBS_DELIMITER));
+	ui16_length = test_encode(USART_FRAME_COBS, (const BYTE*)"\x03\x00", 2);
+	for (UINT16 i = 0; i < ui16_length - 1; ++i)
+		TEST_CHECK(USART_FRAME_PENDING == usartFrameDecodeByte(&dec, ac_encoded[i]));
+	TEST_CHECK((USART_FRAME_READY == usartFrameDecodeByte(&dec, ac_encoded[ui16_length - 1])) && (2 == dec.ui16_length));
+
+	// payload longer than decoder buffer
+	ui16_length = test_encode(USART_FRAME_COBS, ac_payload, 20);
+	usartFrameDecoderInit(&dec, USART_FRAME_COBS, ac_decoded, 19);
+	for (UINT16 i = 0; i < ui16_length - 1; ++i)
+		usartFrameDecodeByte(&dec, ac_encoded[i]);
+	TEST_CHECK(USART_FRAME_ERROR == usartFrameDecodeByte(&dec, ac_encoded[ui16_length - 1]));
+
+	// frames following each other in rx ring are received one per call
+	usartFrameDecoderInit(&dec, USART_FRAME_COBS, ac_decoded, sizeof(ac_decoded));
+	TEST_CHECK(USART_FRAME_PENDING == usartFrameReceive(&usart, &dec));
+	ui16_length = test_encode(USART_FRAME_COBS, (const BYTE*)"\x01\x00\x02", 3);
+	for (UINT16 i = 0; i < ui16_length; ++i)
+		usartIsrRxByte(&usart, ac_encoded[i]);
+	ui16_length = test_encode(USART_FRAME_COBS, (const BYTE*)"\x04", 1);
+	for (UINT16 i = 0; i < ui16_length; ++i)
+		usartIsrRxByte(&usart, ac_encoded[i]);
+	TEST_CHECK((USART_FRAME_READY == usartFrameReceive(&usart, &dec)) && (3 == dec.ui16_length) && !memcmp(ac_decoded, "\x01\x00\x02", 3));
+	TEST_CHECK((USART_FRAME_READY == usartFrameReceive(&usart, &dec)) && (1 == dec.ui16_length) && (0x04 == ac_decoded[0]));
+	TEST_CHECK(USART_FRAME_PENDING == usartFrameReceive(&usart, &dec));
+	TEST_CHECK(!usartUnreadBytes(&usart));
+
+	return (testResult("test_usart_frame", ui32_errors));
+}
+
+// static functions
+// --------------------------------------------------------------------------
+static UINT16 test_encode(const e_usartframe_type_t type, const BYTE *pc_data, const UINT16 ui16_length)
+{
+	UINT16 ui16_encoded = 0;
+
+	if (USART_FRAME_SLIP == type)
+		usartFrameSlipSend(&usart, pc_data, ui16_length);
+	else
+		usartFrameCobsSend(&usart, pc_data, ui16_length);
+
+	// take encoded frame from tx ring as tx interrupt would do
+	while ((ui16_encoded < sizeof(ac_encoded)) && usartIsrTxByte(&usart, &ac_encoded[ui16_encoded]))
+		++ui16_encoded;
+
+	return (ui16_encoded);
+}
+
+// --------------------------------------------------------------------------
+static BOOL test_roundTrip(const e_usartframe_type_t type, const BYTE *pc_data, const UINT16 ui16_length)
+{
+	usart_frame_dec_st dec;
+	UINT16 ui16_encoded = test_encode(type, pc_data, ui16_length);
+
+	if (!ui16_encoded)
+		return (false);
+
+	// only delimiter may complete frame, one byte at a time
+	usartFrameDecoderInit(&dec, type, ac_decoded, sizeof(ac_decoded));
+	for (UINT16 i = 0; i < ui16_encoded - 1; ++i)
+	{
+		if (USART_FRAME_PENDING != usartFrameDecodeByte(&dec, ac_encoded[i]))
+			return (false);
+	}
+	if (USART_FRAME_READY != usartFrameDecodeByte(&dec, ac_encoded[ui16_encoded - 1]))
+		return (false);
+
+	return ((dec.ui16_length == ui16_length) && !memcmp(ac_decoded, pc_data, ui16_length));
+}
+
+// END
@@ -0,0 +1,100 @@
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+
+/*!
+ * \file test_usart_read.c
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief usart non-blocking read with jiffies deadline - host test
+ * \details
+ * Read collects bytes over several polls and times out exactly at deadline, also when jiffies wrap around
+ * during read. Jiffies are advanced by test.
+ */
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#define SYNC_TIMER_JIFFIES
+
+#include <stdio.h>
+#include <string.h>
+
+#include "ehal/ring/ring.c"
+#include "ehal/usart/usart.c"
+#include "lib/usart/usart_march.c"
+#include "lib/util/util_march.c"
+#include "test.h"
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+#define TEST_TIMEOUT_MS 32
+
+volatile UINT32 jiffies;
+
+static USART_TypeDef usart_if;
+static usart_cfg_st usart;
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+// --------------------------------------------------------------------------
+int main(void)
+{
+	UINT32 ui32_errors = 0;
+	usart_read_ctx_st ctx;
+	BYTE ac_buff[8];
+
+	usart.usart_if = &usart_if;
+	usartFlush(&usart);
+
+	// deadline after jiffies wrap, pending until the last tick before it
+	jiffies = 0xFFFFFFF0UL;
+	usartReadStart(&ctx, ac_buff, sizeof(ac_buff), TEST_TIMEOUT_MS);
+	usartIsrRxByte(&usart, 1);
+	usartIsrRxByte(&usart, 2);
+	TEST_CHECK(USART_READ_PENDING == usartReadPoll(&usart, &ctx));
+	TEST_CHECK(2 == ctx.ui16_done);
+	jiffies += 20;
+	TEST_CHECK(USART_READ_PENDING == usartReadPoll(&usart, &ctx));
+	jiffies += TEST_TIMEOUT_MS - 20 - 1;
+	usartIsrRxByte(&usart, 3);
+	TEST_CHECK(USART_READ_PENDING == usartReadPoll(&usart, &ctx));
+	TEST_CHECK((3 == ctx.ui16_done) && !memcmp(ac_buff, "\x01\x02\x03", 3));
+	++jiffies;
+	TEST_CHECK(USART_READ_TIMEOUT == usartReadPoll(&usart, &ctx));
+
+	// completed read is done regardless of deadline
+	usartReadStart(&ctx, ac_buff, 4, TEST_TIMEOUT_MS);
+	for (UINT8 i = 0; i < 6; ++i)
+		usartIsrRxByte(&usart, 10 + i);
+	TEST_CHECK(USART_READ_DONE == usartReadPoll(&usart, &ctx));
+	TEST_CHECK(!memcmp(ac_buff, "\x0A\x0B\x0C\x0D", 4));
+	TEST_CHECK(2 == usartUnreadBytes(&usart));
+	jiffies += 1000;
+	TEST_CHECK(USART_READ_DONE == usartReadPoll(&usart, &ctx));
+
+	// blocking read, waiting bytes are returned at once, zero timeout expires immediately
+	TEST_CHECK(usartRead(&usart, ac_buff, 2, 0));
+	TEST_CHECK(!memcmp(ac_buff, "\x0E\x0F", 2));
+	TEST_CHECK(!usartRead(&usart, ac_buff, 1, 0));
+
+	return (testResult("test_usart_read", ui32_errors));
+}
+
+// END
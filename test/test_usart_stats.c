@@ -0,0 +1,89 @@
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+
+
+/*!
+ * \file test_usart_stats.c
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief usart port statistics - host test
+ * \details
+ * Counters updated from rx interrupt and from transmit functions are read and cleared, both with interrupts
+ * of port masked.
+ */
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#define USART_STATS
+#define USART_RBUF_SIZE 16
+
+#include <stdio.h>
+#include <string.h>
+
+#include "ehal/ring/ring.c"
+#include "ehal/usart/usart.c"
+#include "lib/usart/usart_march.c"
+#include "lib/util/util_march.c"
+#include "test.h"
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+#define TEST_RX 20
+
+static USART_TypeDef usart_if;
+static usart_cfg_st usart;
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+// --------------------------------------------------------------------------
+int main(void)
+{
+	UINT32 ui32_errors = 0;
+	usart_stats_st stats;
+
+	usart.usart_if = &usart_if;
+	usartFlush(&usart);
+
+	// rx ring overflows once, tail of burst is dropped
+	for (UINT8 i = 0; i < TEST_RX; ++i)
+		usartIsrRxByte(&usart, i);
+	usartIsrRxError(&usart, USART_ERROR_FRAMING);
+	usartIsrRxError(&usart, USART_ERROR_FRAMING);
+	usartIsrRxError(&usart, USART_ERROR_PARITY);
+	usartIsrRxError(&usart, USART_ERROR_OVERRUN);
+	usartSendString(&usart, (const BYTE*)"abc", 10);
+
+	usartStatsGet(&usart, &stats);
+	TEST_CHECK((1 == usart_if.ui32_isr_masks) && !usart_if.b_isr_masked);
+	TEST_CHECK((USART_RBUF_SIZE == stats.ui32_rx_bytes) && (USART_RBUF_SIZE == stats.ui16_rx_high_water));
+	TEST_CHECK((TEST_RX - USART_RBUF_SIZE == stats.ui32_rx_dropped) && (1 == stats.ui16_rx_overflows));
+	TEST_CHECK((2 == stats.ui16_framing_errors) && (1 == stats.ui16_parity_errors) && (1 == stats.ui16_hw_overruns));
+	TEST_CHECK(3 == stats.ui32_tx_bytes);
+
+	usartStatsReset(&usart);
+	TEST_CHECK((2 == usart_if.ui32_isr_masks) && !usart_if.b_isr_masked);
+	usartStatsGet(&usart, &stats);
+	TEST_CHECK(!stats.ui32_rx_bytes && !stats.ui32_rx_dropped && !stats.ui16_framing_errors && !stats.ui32_tx_bytes);
+
+	return (testResult("test_usart_stats", ui32_errors));
+}
+
+// END
@@ -24,9 +24,12 @@
  ***************************************************************************/
 
 #include "ehal/usart/usart.h"
+#include "ehal/sync_timer/sync_timer.h"
 #include "ehal/util/util.h"
 #include "lib/usart/usart_march.h"
 
+#include <string.h>
+
 
 /***************************************************************************
  *	DEFINITIONS
@@ -37,12 +40,34 @@
 	#error "USART: USART_SEND_MAX_LENGTH not set"
 #endif
 
-#ifndef USART_BIG_BUFFERS
-	#if (USART_RBUF_SIZE >= 0xFF | USART_TBUF_SIZE >= 0xFF)
-		#error "USART: buffers too big (max = 256 bytes)"
-	#endif
+#if (defined(USART_BIG_BUFFERS) && !defined(RING_BIG_BUFFERS))
+	#error "USART: USART_BIG_BUFFERS requires RING_BIG_BUFFERS"
+#endif
+
+#if (!RING_SIZE_VALID(USART_RBUF_SIZE) || !RING_SIZE_VALID(USART_TBUF_SIZE))
+	#error "USART: buffer sizes have to be powers of two (max = RING_SIZE_MAX bytes)"
 #endif
 
+#ifdef USART_RX_FRAMES
+	#if (!USART_RX_FRAMES || (USART_RX_FRAMES & (USART_RX_FRAMES - 1)) || (USART_RX_FRAMES > 0x80))
+		#error "USART: USART_RX_FRAMES has to be a power of two (max = 128)"
+	#endif
+
+	#define USART_RX_FRAMES_MASK (USART_RX_FRAMES - 1)
+#endif // USART_RX_FRAMES
+
+// static functions
+static VOID usart_startTx(usart_cfg_st *usart);
+#ifdef USART_STATS
+static UINT32 usart_statsNow(void);
+static VOID usart_statsTx(usart_cfg_st *usart, const UINT16 ui16_length);
+static VOID usart_statsTxWait(usart_cfg_st *usart, const UINT32 ui32_start);
+#endif // USART_STATS
+#ifdef USART_DMA_TX
+static VOID usart_dmaTxNext(usart_cfg_st *usart);
+#endif // USART_DMA_TX
+static VOID usart_sendSpan(usart_cfg_st *usart, const BYTE *pc_str, UINT16 ui16_length);
+
 
 /***************************************************************************
  *	FUNCTIONS
@@ -51,34 +76,95 @@
 // --------------------------------------------------------------------------
 VOID usartFlush(usart_cfg_st *usart)
 {
-	usart->usart_rx_tail = 0;
-	usart->usart_rx_head = 0;
-	usart->usart_tx_tail = 0;
-	usart->usart_tx_head = 0;
+	ringInit(&usart->usart_rx_ring, usart->ac_usart_rx_buff, USART_RBUF_SIZE);
+	ringInit(&usart->usart_tx_ring, usart->ac_usart_tx_buff, USART_TBUF_SIZE);
 
 	usart->b_usart_rx_overflow = false;
-	usart->b_usart_tx_full = false;
+#ifdef USART_DMA_TX
+	usart->usart_tx_dma_len = 0;
+#endif // USART_DMA_TX
+#ifdef USART_RX_FRAMES
+	usart->usart_rx_frame_start = 0;
+	usart->usart_rx_frame_head = 0;
+	usart->usart_rx_frame_tail = 0;
+#endif // USART_RX_FRAMES
+}
+
+#ifdef USART_DMA_TX
+// --------------------------------------------------------------------------
+VOID usartIsrDmaTxComplete(usart_cfg_st *usart)
+{
+	ringConsume(&usart->usart_tx_ring, usart->usart_tx_dma_len);
+
+	// chain wrapped around segment or data queued meanwhile
+	usart_dmaTxNext(usart);
+	if (!usart->usart_tx_dma_len && usart->usart_tx_done_cb)
+		usart->usart_tx_done_cb();
+}
+#endif // USART_DMA_TX
+
+#ifdef USART_RX_FRAMES
+// --------------------------------------------------------------------------
+VOID usartIsrRxIdle(usart_cfg_st *usart)
+{
+	ring_size_t head = usart->usart_rx_ring.head;
+	ring_size_t length = head - usart->usart_rx_frame_start;
+	UINT8 ui8_frame = usart->usart_rx_frame_head;
+
+	// idle period without received data
+	if (!length)
+		return;
+
+	// queue frame, if queue is full bytes stay in ring and are joined with next frame
+	if ((UINT8)(ui8_frame - usart->usart_rx_frame_tail) >= USART_RX_FRAMES)
+		return;
+
+	usart->usart_rx_frames[ui8_frame & USART_RX_FRAMES_MASK].start = usart->usart_rx_frame_start;
+	usart->usart_rx_frames[ui8_frame & USART_RX_FRAMES_MASK].length = length;
+	RING_BARRIER();
+	usart->usart_rx_frame_head = ui8_frame + 1;
+	usart->usart_rx_frame_start = head;
 }
+#endif // USART_RX_FRAMES
 
 // --------------------------------------------------------------------------
 USART_USARTREAD_ATTR BOOL usartRead(usart_cfg_st *usart, BYTE *pc_str, const UINT16 ui16_count, UINT16 ui16_val)
 {
-	for (UINT16 i = 0; i < ui16_count; ++i)
+#ifdef SYNC_TIMER_JIFFIES
+	usart_read_ctx_st ctx;
+	e_usartread_t result;
+
+	usartReadStart(&ctx, pc_str, ui16_count, ui16_val);
+	do
+		result = usartReadPoll(usart, &ctx);
+	while (USART_READ_PENDING == result);
+
+	return (USART_READ_DONE == result);
+#else
+	UINT16 ui16_remaining = ui16_count;
+	UINT16 ui16_read;
+
+	while (ui16_remaining)
 	{
-		// wait for incomming byte no more than ui16_val miliseconds
-		while (!usartUnreadBytes(usart))
+		// take everything that is already waiting
+		ui16_read = ringRead(&usart->usart_rx_ring, pc_str, ui16_remaining);
+		if (ui16_read)
 		{
-			if (ui16_val == 0)
-				return (false);
-			--ui16_val;
-			delayMs(1);
+			usart->b_usart_rx_overflow = false;
+			pc_str += ui16_read;
+			ui16_remaining -= ui16_read;
+			continue;
 		}
 
-		*pc_str = usartReadByte(usart);
-		++pc_str;
+		// wait for incomming bytes no more than ui16_val miliseconds
+		if (ui16_val == 0)
+			return (false);
+		--ui16_val;
+		delayMs(1);
 	}
 
 	return (true);
+#endif // SYNC_TIMER_JIFFIES
 }
 
 // --------------------------------------------------------------------------
@@ -86,25 +172,97 @@ USART_USARTREADBYTE_ATTR BYTE usartReadByte(usart_cfg_st *usart)
 {
 	BYTE b;
 
-	// wait for byte
-	WAIT_FOR(!usartUnreadBytes(usart));
-
-	// get byte from buffer and update pointers
-	b = usart->ac_usart_rx_buff[usart->usart_rx_tail];
-	usart->usart_rx_tail++;
-	if (usart->usart_rx_tail > (USART_RBUF_SIZE - 1))
-		usart->usart_rx_tail = 0;
+	// wait for byte and take it from buffer
+	WAIT_FOR(!ringGet(&usart->usart_rx_ring, &b));
 	usart->b_usart_rx_overflow = false;
 
 	return (b);
 }
 
+#ifdef SYNC_TIMER_JIFFIES
+// --------------------------------------------------------------------------
+e_usartread_t usartReadPoll(usart_cfg_st *usart, usart_read_ctx_st *ctx)
+{
+	UINT16 ui16_read;
+
+	// take everything that is already waiting
+	ui16_read = ringRead(&usart->usart_rx_ring, ctx->pc_buff + ctx->ui16_done, ctx->ui16_count - ctx->ui16_done);
+	if (ui16_read)
+	{
+		usart->b_usart_rx_overflow = false;
+		ctx->ui16_done += ui16_read;
+	}
+
+	if (ctx->ui16_done == ctx->ui16_count)
+		return (USART_READ_DONE);
+	// wrap safe deadline check
+	if (TIME_AFTER_EQ(jiffies, ctx->ui32_deadline))
+		return (USART_READ_TIMEOUT);
+
+	return (USART_READ_PENDING);
+}
+
+// --------------------------------------------------------------------------
+VOID usartReadStart(usart_read_ctx_st *ctx, BYTE *pc_str, const UINT16 ui16_count, const UINT16 ui16_timeout_ms)
+{
+	ctx->pc_buff = pc_str;
+	ctx->ui16_count = ui16_count;
+	ctx->ui16_done = 0;
+	ctx->ui32_deadline = jiffies + ui16_timeout_ms;
+}
+#endif // SYNC_TIMER_JIFFIES
+
 // --------------------------------------------------------------------------
 BOOL usartReceiveBufferOverflow(const usart_cfg_st *usart)
 {
 	return (usart->b_usart_rx_overflow);
 }
 
+// --------------------------------------------------------------------------
+VOID usartRxConsume(usart_cfg_st *usart, const usart_bufsize_t length)
+{
+	ringConsume(&usart->usart_rx_ring, length);
+	usart->b_usart_rx_overflow = false;
+}
+
+#ifdef USART_RX_FRAMES
+// --------------------------------------------------------------------------
+BOOL usartRxFrameGet(usart_cfg_st *usart, ring_span_st *p_frame)
+{
+	UINT8 ui8_frame = usart->usart_rx_frame_tail;
+
+	if (usart->usart_rx_frame_head == ui8_frame)
+		return (false);
+
+	RING_BARRIER();
+	*p_frame = usart->usart_rx_frames[ui8_frame & USART_RX_FRAMES_MASK];
+	RING_BARRIER();
+	usart->usart_rx_frame_tail = ui8_frame + 1;
+
+	return (true);
+}
+
+// --------------------------------------------------------------------------
+VOID usartRxFramingEnable(usart_cfg_st *usart, const UINT16 ui16_timeout_bits)
+{
+	// start with empty ring, so first frame is not joined with stale bytes
+	ringConsume(&usart->usart_rx_ring, ringUsed(&usart->usart_rx_ring));
+	usart->usart_rx_frame_start = usart->usart_rx_ring.tail;
+	usart->usart_rx_frame_tail = usart->usart_rx_frame_head;
+
+	march_usartRxTimeoutEnable(usart, ui16_timeout_bits);
+}
+#endif // USART_RX_FRAMES
+
+// --------------------------------------------------------------------------
+VOID usartRxPeek(usart_cfg_st *usart, const BYTE **ppc_data, usart_bufsize_t *p_length)
+{
+	BYTE *pc_data;
+
+	*p_length = ringPeek(&usart->usart_rx_ring, &pc_data);
+	*ppc_data = pc_data;
+}
+
 // --------------------------------------------------------------------------
 VOID usartSend(usart_cfg_st *usart, const BYTE *pc_str, const UINT16 ui16_length)
 {
@@ -116,33 +274,66 @@ VOID usartSend(usart_cfg_st *usart, const BYTE *pc_str, const UINT16 ui16_length
 	else
 		ui16_computed_length = (ui16_length > USART_SEND_MAX_LENGTH)?(USART_SEND_MAX_LENGTH):(ui16_length);
 
-	// start sending data
-	for (UINT16 i = 0; i < ui16_computed_length; ++i)
-		usartSendByte(usart, *(pc_str + i));
+	usart_sendSpan(usart, pc_str, ui16_computed_length);
 }
 
 // --------------------------------------------------------------------------
 USART_USARTSENDBYTE_ATTR VOID usartSendByte(usart_cfg_st *usart, const BYTE c_byte)
 {
-	// wait for free space in send buffer
-	WAIT_FOR(usart->b_usart_tx_full);
+	// wait for free space in send buffer and insert byte
+	if (!ringPut(&usart->usart_tx_ring, c_byte))
+	{
+#ifdef USART_STATS
+		UINT32 ui32_start = usart_statsNow();
+#endif // USART_STATS
+		WAIT_FOR(!ringPut(&usart->usart_tx_ring, c_byte));
+#ifdef USART_STATS
+		usart_statsTxWait(usart, ui32_start);
+#endif // USART_STATS
+	}
 
-	// insert byte to transmit buffer
-	usart->ac_usart_tx_buff[usart->usart_tx_head] = c_byte;
-	usart->usart_tx_head++;
-	if (usart->usart_tx_head > (USART_TBUF_SIZE - 1))
-		usart->usart_tx_head = 0;
+#ifdef USART_STATS
+	usart_statsTx(usart, 1);
+#endif // USART_STATS
+	usart_startTx(usart);
+}
 
-	if (usart->usart_tx_head == usart->usart_tx_tail)
-		usart->b_usart_tx_full = true;
+#ifdef USART_STATS
+// --------------------------------------------------------------------------
+VOID usartStatsGet(const usart_cfg_st *usart, usart_stats_st *p_stats)
+{
+	// multi-byte counters are updated by rx interrupt
+	march_usartIsrMask(usart);
+	*p_stats = usart->usart_stats;
+	march_usartIsrUnmask(usart);
+}
 
-	march_usartEnableTXEInterrupt(usart);
+// --------------------------------------------------------------------------
+VOID usartStatsReset(usart_cfg_st *usart)
+{
+	march_usartIsrMask(usart);
+	memset(&usart->usart_stats, 0, sizeof(usart->usart_stats));
+	march_usartIsrUnmask(usart);
 }
+#endif // USART_STATS
+
+#ifdef USART_DMA_TX
+// --------------------------------------------------------------------------
+VOID usartSetTxDma(usart_cfg_st *usart, const BOOL b_enable, const usart_tx_done_cb_t cb)
+{
+	// switch mode only when transmitter is idle
+	WAIT_FOR(!ringIsEmpty(&usart->usart_tx_ring));
+
+	usart->usart_tx_done_cb = cb;
+	usart->b_usart_tx_dma = b_enable;
+}
+#endif // USART_DMA_TX
 
 // --------------------------------------------------------------------------
 USART_USARTSENDSTRING_ATTR VOID usartSendString(usart_cfg_st *usart, const BYTE *pc_str, const UINT16 ui16_length)
 {
 	UINT16 ui16_computed_length;
+	const BYTE *pc_end;
 
 	// compute max length of data to send
 	if (!ui16_length)
@@ -150,35 +341,112 @@ USART_USARTSENDSTRING_ATTR VOID usartSendString(usart_cfg_st *usart, const BYTE
 	else
 		ui16_computed_length = (ui16_length > USART_SEND_MAX_LENGTH)?(USART_SEND_MAX_LENGTH):(ui16_length);
 
-	// start sending data
-	for (UINT16 i = 0; (i < ui16_computed_length) && *(pc_str + i); ++i)
-		usartSendByte(usart, *(pc_str + i));
+	// send up to string terminator
+	pc_end = memchr(pc_str, 0, ui16_computed_length);
+	if (pc_end)
+		ui16_computed_length = pc_end - pc_str;
+
+	usart_sendSpan(usart, pc_str, ui16_computed_length);
 }
 
 // --------------------------------------------------------------------------
 USART_USARTUNREADBYTES_ATTR usart_bufsize_t usartUnreadBytes(const usart_cfg_st *usart)
 {
-	if (usart->usart_rx_head > usart->usart_rx_tail)
-		return (usart->usart_rx_head - usart->usart_rx_tail);
-	else if (usart->usart_rx_head < usart->usart_rx_tail)
-		return (USART_RBUF_SIZE - (usart->usart_rx_tail - usart->usart_rx_head));
-	else if (usart->b_usart_rx_overflow)
-		return (USART_RBUF_SIZE);
-
-	return (0);
+	return (ringUsed(&usart->usart_rx_ring));
 }
 
 // --------------------------------------------------------------------------
 usart_bufsize_t usartUnsentBytes(const usart_cfg_st *usart)
 {
-	if (usart->usart_tx_head > usart->usart_tx_tail)
-		return (usart->usart_tx_head - usart->usart_tx_tail);
-	else if (usart->usart_tx_head < usart->usart_tx_tail)
-		return (USART_TBUF_SIZE - (usart->usart_tx_tail - usart->usart_tx_head));
-	else if (usart->b_usart_tx_full)
-		return (USART_TBUF_SIZE);
+	return (ringUsed(&usart->usart_tx_ring));
+}
+
+// static functions
+// --------------------------------------------------------------------------
+static VOID usart_startTx(usart_cfg_st *usart)
+{
+#ifdef USART_DMA_TX
+	if (usart->b_usart_tx_dma)
+	{
+		// running transfer picks up new data on completion
+		if (!usart->usart_tx_dma_len)
+			usart_dmaTxNext(usart);
+		return;
+	}
+#endif // USART_DMA_TX
+
+	march_usartEnableTXEInterrupt(usart);
+}
 
+#ifdef USART_STATS
+// --------------------------------------------------------------------------
+static UINT32 usart_statsNow(void)
+{
+#ifdef SYNC_TIMER_JIFFIES
+	return (jiffies);
+#else
 	return (0);
+#endif // SYNC_TIMER_JIFFIES
+}
+
+// --------------------------------------------------------------------------
+static VOID usart_statsTx(usart_cfg_st *usart, const UINT16 ui16_length)
+{
+	usart->usart_stats.ui32_tx_bytes += ui16_length;
+	if (ringUsed(&usart->usart_tx_ring) > usart->usart_stats.ui16_tx_high_water)
+		usart->usart_stats.ui16_tx_high_water = ringUsed(&usart->usart_tx_ring);
+}
+
+// --------------------------------------------------------------------------
+static VOID usart_statsTxWait(usart_cfg_st *usart, const UINT32 ui32_start)
+{
+	UINT32 ui32_wait = usart_statsNow() - ui32_start;
+
+	if (ui32_wait > usart->usart_stats.ui32_tx_wait_max)
+		usart->usart_stats.ui32_tx_wait_max = ui32_wait;
+}
+#endif // USART_STATS
+
+#ifdef USART_DMA_TX
+// --------------------------------------------------------------------------
+static VOID usart_dmaTxNext(usart_cfg_st *usart)
+{
+	BYTE *pc_data;
+
+	// length has to be known before transfer complete interrupt may fire
+	usart->usart_tx_dma_len = ringPeek(&usart->usart_tx_ring, &pc_data);
+	if (usart->usart_tx_dma_len)
+		march_usartDmaTxStart(usart, pc_data, usart->usart_tx_dma_len);
+}
+#endif // USART_DMA_TX
+
+// --------------------------------------------------------------------------
+static VOID usart_sendSpan(usart_cfg_st *usart, const BYTE *pc_str, UINT16 ui16_length)
+{
+	UINT16 ui16_written;
+
+	while (ui16_length)
+	{
+		// wait for transmitter to drain full buffer, copy as much as fits
+		if (!ringFree(&usart->usart_tx_ring))
+		{
+#ifdef USART_STATS
+			UINT32 ui32_start = usart_statsNow();
+#endif // USART_STATS
+			WAIT_FOR(!ringFree(&usart->usart_tx_ring));
+#ifdef USART_STATS
+			usart_statsTxWait(usart, ui32_start);
+#endif // USART_STATS
+		}
+
+		ui16_written = ringWrite(&usart->usart_tx_ring, pc_str, ui16_length);
+#ifdef USART_STATS
+		usart_statsTx(usart, ui16_written);
+#endif // USART_STATS
+		usart_startTx(usart);
+		pc_str += ui16_written;
+		ui16_length -= ui16_written;
+	}
 }
 
 // END
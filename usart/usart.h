@@ -14,7 +14,35 @@
  * - USART_RBUF_SIZE - size of rx ring buffer
  * - USART_TBUF_SIZE - size of tx ring buffer
  * - USART_SEND_MAX_LENGTH - max length of transmitted data block
- * - USART_BIG_BUFFERS - enable support for buffers bigger than 256 bytes
+ * - USART_BIG_BUFFERS - enable support for buffers bigger than 128 bytes (requires RING_BIG_BUFFERS)
+ *
+ * Buffer sizes have to be powers of two. Both buffers are lock-free single producer / single consumer rings
+ * (see ring.h), usart_cfg_st provided by usart_march.h has to contain:
+ * - ac_usart_rx_buff, ac_usart_tx_buff - ring storage
+ * - usart_rx_ring, usart_tx_ring - ring control structures
+ * - b_usart_rx_overflow - set when received byte was dropped due to full rx ring
+ *
+ * Architecture interrupt handlers exchange bytes with rings only through usartIsrRxByte() and usartIsrTxByte().
+ *
+ * Optional definitions:
+ * - USART_DMA_TX - enable DMA transmit mode, selected per port with usartSetTxDma(). Contiguous tx ring
+ *                  segments are handed to march_usartDmaTxStart(), architecture DMA transfer complete handler
+ *                  has to call usartIsrDmaTxComplete(), which chains the next (wrapped around) segment.
+ *                  usart_cfg_st has to contain additionally:
+ *                  - b_usart_tx_dma - DMA transmit mode selected
+ *                  - usart_tx_dma_len - length of segment being transferred, 0 if DMA is idle
+ *                  - usart_tx_done_cb - VOID (*)(VOID) callback executed when tx ring was drained by DMA
+ * - USART_RX_FRAMES - enable idle line framing, defines depth of frame queue (power of two). Architecture idle
+ *                     line or receiver timeout interrupt handler has to call usartIsrRxIdle(), which queues
+ *                     position and length of bytes received since previous idle period. Timeout is set up
+ *                     with march_usartRxTimeoutEnable(). usart_cfg_st has to contain additionally:
+ *                     - usart_rx_frame_start - ring index where frame being received starts
+ *                     - usart_rx_frames[USART_RX_FRAMES] - ring_span_st queue of completed frames
+ *                     - usart_rx_frame_head, usart_rx_frame_tail - UINT8 free running queue indices
+ * - USART_STATS - collect per port statistics (see usart_stats.h), architecture interrupt handler reports receive
+ *                 errors with usartIsrRxError(). Counters are copied and cleared with interrupts of port masked
+ *                 by march_usartIsrMask()/march_usartIsrUnmask(). usart_cfg_st has to contain additionally:
+ *                 - usart_stats - usart_stats_st counters
  * \warning
  * Depending on MCU architecture additional configuration definitions may be required.
  * Implementation for particular architecture is contained in related version of library in usart_march.c.
@@ -33,6 +61,8 @@ extern "C" {
 
 #include "config.h"
 #include "ehal/global.h"
+#include "ehal/ring/ring.h"
+#include "ehal/usart/usart_stats.h"
 #include "lib/usart/usart_march.h"
 #include "lib_func_attr.h"
 
@@ -58,6 +88,45 @@ enum e_usartparity
 typedef enum e_usartparity e_usartparity_t;
 
 
+/*!
+ * \enum e_usartread
+ * \brief state of non-blocking read
+ */
+enum e_usartread
+{
+	USART_READ_PENDING = 0,
+	USART_READ_DONE,
+	USART_READ_TIMEOUT
+};
+/*!
+ * \typedef e_usartread_t
+ * \brief state of non-blocking read
+ */
+typedef enum e_usartread e_usartread_t;
+
+#ifdef SYNC_TIMER_JIFFIES
+/*!
+ * \struct usart_read_ctx_st
+ * \brief context of non-blocking read, keeps progress between usartReadPoll invocations
+ */
+typedef struct
+{
+	BYTE *pc_buff;
+	UINT16 ui16_count;
+	UINT16 ui16_done;
+	UINT32 ui32_deadline;
+} usart_read_ctx_st;
+#endif // SYNC_TIMER_JIFFIES
+
+#ifdef USART_DMA_TX
+/*!
+ * \typedef usart_tx_done_cb_t
+ * \brief callback executed from DMA interrupt when all queued data was transferred
+ */
+typedef VOID (*usart_tx_done_cb_t)(VOID);
+#endif // USART_DMA_TX
+
+
 /***************************************************************************
  *	FUNCTIONS
  ***************************************************************************/
@@ -87,11 +156,30 @@ USART_USARTINIT_ATTR VOID usartInit(usart_cfg_st *usart, const UINT16 ui16_baudr
  * \param pc_str pointer to buffer, where data will be written
  * \param ui16_count count of bytes to read
  * \param ui16_val value for timeout, read note!
- * \return pointer to buffer where data was written
- * \note If USART1_USE_TIMER was defined in config.h, defines read timeout in miliseconds, otherwise it defines iteration count after
- * which waitung for byte will be interrupted.
+ * \return true if all bytes were read, false on timeout
+ * \note If SYNC_TIMER_JIFFIES was defined in config.h, defines deadline for whole read in miliseconds, otherwise it defines
+ * number of 1ms waits for incomming bytes after which reading will be interrupted.
  */
 USART_USARTREAD_ATTR BOOL usartRead(usart_cfg_st *usart, BYTE* pc_str, const UINT16 ui16_count, UINT16 ui16_val);
+#ifdef SYNC_TIMER_JIFFIES
+/*!
+ * \fn usartReadPoll(usart_cfg_st *usart, usart_read_ctx_st *ctx)
+ * \brief continue non-blocking read, takes all bytes waiting in rx ring up to requested count
+ * \param ctx read context prepared with usartReadStart
+ * \return USART_READ_DONE if all bytes were read, USART_READ_TIMEOUT if deadline passed, USART_READ_PENDING otherwise
+ * \note Number of bytes read so far is kept in ctx->ui16_done, also after timeout.
+ */
+e_usartread_t usartReadPoll(usart_cfg_st *usart, usart_read_ctx_st *ctx);
+/*!
+ * \fn usartReadStart(usart_read_ctx_st *ctx, BYTE *pc_str, const UINT16 ui16_count, const UINT16 ui16_timeout_ms)
+ * \brief prepare non-blocking read, it does not wait for any data
+ * \param ctx read context
+ * \param pc_str pointer to buffer, where data will be written
+ * \param ui16_count count of bytes to read
+ * \param ui16_timeout_ms deadline for whole read counted in jiffies from now
+ */
+VOID usartReadStart(usart_read_ctx_st *ctx, BYTE *pc_str, const UINT16 ui16_count, const UINT16 ui16_timeout_ms);
+#endif // SYNC_TIMER_JIFFIES
 /*!
  * \fn usart1ReadByte
  * \brief read single byte
@@ -104,6 +192,38 @@ USART_USARTREADBYTE_ATTR BYTE usartReadByte(usart_cfg_st *usart);
  * \return true if receive buffer overflow occured, false otherwise
  */
 BOOL usartReceiveBufferOverflow(const usart_cfg_st *usart);
+#ifdef USART_RX_FRAMES
+/*!
+ * \fn usartRxFrameGet(usart_cfg_st *usart, ring_span_st *p_frame)
+ * \brief take next frame delimited by line idle period or inter-byte timeout
+ * \param p_frame location for frame position in rx ring and its length
+ * \return true if frame was taken, false if no complete frame is waiting
+ * \note Frames follow each other in rx ring. When frames are consumed in order (usartRxConsume with frame
+ * length), frame start is the current read position, so its data is given by usartRxPeek.
+ */
+BOOL usartRxFrameGet(usart_cfg_st *usart, ring_span_st *p_frame);
+/*!
+ * \fn usartRxFramingEnable(usart_cfg_st *usart, const UINT16 ui16_timeout_bits)
+ * \brief enable idle line framing, bytes waiting in rx ring are dropped
+ * \param ui16_timeout_bits inter-byte timeout in bit times, 0 for idle line detection (one character)
+ */
+VOID usartRxFramingEnable(usart_cfg_st *usart, const UINT16 ui16_timeout_bits);
+#endif // USART_RX_FRAMES
+/*!
+ * \fn usartRxConsume(usart_cfg_st *usart, const usart_bufsize_t length)
+ * \brief release received bytes inspected in place with usartRxPeek
+ * \param length number of bytes to release (limited to unread bytes count)
+ */
+VOID usartRxConsume(usart_cfg_st *usart, const usart_bufsize_t length);
+/*!
+ * \fn usartRxPeek(usart_cfg_st *usart, const BYTE **ppc_data, usart_bufsize_t *p_length)
+ * \brief give access to oldest contiguous region of received bytes without copying
+ * \param ppc_data location for pointer to received data in rx ring
+ * \param p_length location for length of contiguous region, 0 if nothing was received
+ * \note Region stays valid until released with usartRxConsume. If received data wraps around the end
+ * of rx ring, the remaining part is given by next usartRxPeek after consuming the first one.
+ */
+VOID usartRxPeek(usart_cfg_st *usart, const BYTE **ppc_data, usart_bufsize_t *p_length);
 /*!
  * \fn usart1Send(BYTE* pc_str, const UINT16 ui16_length)
  * \brief send data from buffer
@@ -111,6 +231,16 @@ BOOL usartReceiveBufferOverflow(const usart_cfg_st *usart);
  * \param ui16_length max length of given string (limited to USART_SEND_MAX_LENGTH)
  */
 VOID usartSend(usart_cfg_st *usart, const BYTE* pc_str, const UINT16 ui16_length);
+#ifdef USART_DMA_TX
+/*!
+ * \fn usartSetTxDma(usart_cfg_st *usart, const BOOL b_enable, const usart_tx_done_cb_t cb)
+ * \brief select DMA or interrupt driven transmission for port
+ * \param b_enable true to transmit with DMA, false to use TXE interrupt
+ * \param cb callback executed when DMA drained tx ring, may be NULL
+ * \note Waits until data queued so far is sent.
+ */
+VOID usartSetTxDma(usart_cfg_st *usart, const BOOL b_enable, const usart_tx_done_cb_t cb);
+#endif // USART_DMA_TX
 /*!
  * \fn usart1SendByte(const BYTE c_byte)
  * \brief send single byte
@@ -124,6 +254,19 @@ USART_USARTSENDBYTE_ATTR VOID usartSendByte(usart_cfg_st *usart, const BYTE c_by
  * \param ui16_length max length of given string (limited to USART_SEND_MAX_LENGTH)
  */
 USART_USARTSENDSTRING_ATTR VOID usartSendString(usart_cfg_st *usart, const BYTE* pc_str, const UINT16 ui16_length);
+#ifdef USART_STATS
+/*!
+ * \fn usartStatsGet(const usart_cfg_st *usart, usart_stats_st *p_stats)
+ * \brief take snapshot of port statistics
+ * \param p_stats location for statistics
+ */
+VOID usartStatsGet(const usart_cfg_st *usart, usart_stats_st *p_stats);
+/*!
+ * \fn usartStatsReset(usart_cfg_st *usart)
+ * \brief clear port statistics
+ */
+VOID usartStatsReset(usart_cfg_st *usart);
+#endif // USART_STATS
 /*!
  * \fn usart1UnreadBytes
  * \brief unread bytes count
@@ -137,6 +280,109 @@ USART_USARTUNREADBYTES_ATTR usart_bufsize_t usartUnreadBytes(const usart_cfg_st
  */
 usart_bufsize_t usartUnsentBytes(const usart_cfg_st *usart);
 
+#ifdef USART_RX_FRAMES
+/*!
+ * \fn march_usartRxTimeoutEnable(usart_cfg_st *usart, const UINT16 ui16_timeout_bits)
+ * \brief enable idle line (0) or receiver timeout interrupt, implemented in usart_march.c
+ * \param ui16_timeout_bits inter-byte timeout in bit times
+ */
+VOID march_usartRxTimeoutEnable(usart_cfg_st *usart, const UINT16 ui16_timeout_bits);
+/*!
+ * \fn usartIsrRxIdle(usart_cfg_st *usart)
+ * \brief close frame received so far, to be called from architecture idle line / receiver timeout
+ * interrupt handler
+ */
+VOID usartIsrRxIdle(usart_cfg_st *usart);
+#endif // USART_RX_FRAMES
+
+#ifdef USART_STATS
+/*!
+ * \fn march_usartIsrMask(const usart_cfg_st *usart)
+ * \brief mask interrupts of port (e.g. its interrupt controller line), implemented in usart_march.c
+ * \note interrupt enable flags of peripheral are not changed, masked interrupts stay pending
+ */
+VOID march_usartIsrMask(const usart_cfg_st *usart);
+/*!
+ * \fn march_usartIsrUnmask(const usart_cfg_st *usart)
+ * \brief unmask interrupts of port masked with march_usartIsrMask(), implemented in usart_march.c
+ */
+VOID march_usartIsrUnmask(const usart_cfg_st *usart);
+#endif // USART_STATS
+
+#ifdef USART_DMA_TX
+/*!
+ * \fn march_usartDmaTxStart(usart_cfg_st *usart, const BYTE *pc_data, const UINT16 ui16_length)
+ * \brief start DMA transfer of given memory region to transmitter, implemented in usart_march.c
+ * \param pc_data region start (part of tx ring)
+ * \param ui16_length region length, never 0
+ */
+VOID march_usartDmaTxStart(usart_cfg_st *usart, const BYTE *pc_data, const UINT16 ui16_length);
+/*!
+ * \fn usartIsrDmaTxComplete(usart_cfg_st *usart)
+ * \brief release transferred segment and start next one, to be called from architecture DMA transfer
+ * complete interrupt handler
+ */
+VOID usartIsrDmaTxComplete(usart_cfg_st *usart);
+#endif // USART_DMA_TX
+
+/*!
+ * \fn usartIsrRxByte(usart_cfg_st *usart, const BYTE c_byte)
+ * \brief store received byte in rx ring, to be called from architecture rx interrupt handler
+ * \param c_byte received byte
+ * \note Byte is dropped and overflow is signalled if rx ring is full.
+ */
+static inline VOID usartIsrRxByte(usart_cfg_st *usart, const BYTE c_byte)
+{
+	if (!ringPut(&usart->usart_rx_ring, c_byte))
+	{
+#ifdef USART_STATS
+		++usart->usart_stats.ui32_rx_dropped;
+		if (!usart->b_usart_rx_overflow)
+			++usart->usart_stats.ui16_rx_overflows;
+#endif // USART_STATS
+		usart->b_usart_rx_overflow = true;
+		return;
+	}
+
+#ifdef USART_STATS
+	++usart->usart_stats.ui32_rx_bytes;
+	if (ringUsed(&usart->usart_rx_ring) > usart->usart_stats.ui16_rx_high_water)
+		usart->usart_stats.ui16_rx_high_water = ringUsed(&usart->usart_rx_ring);
+#endif // USART_STATS
+}
+#ifdef USART_STATS
+/*!
+ * \fn usartIsrRxError(usart_cfg_st *usart, const e_usarterror_t error)
+ * \brief count receive error, to be called from architecture rx interrupt handler
+ * \param error detected error
+ */
+static inline VOID usartIsrRxError(usart_cfg_st *usart, const e_usarterror_t error)
+{
+	switch (error)
+	{
+		case USART_ERROR_FRAMING:
+			++usart->usart_stats.ui16_framing_errors;
+			break;
+		case USART_ERROR_PARITY:
+			++usart->usart_stats.ui16_parity_errors;
+			break;
+		case USART_ERROR_OVERRUN:
+			++usart->usart_stats.ui16_hw_overruns;
+			break;
+	}
+}
+#endif // USART_STATS
+/*!
+ * \fn usartIsrTxByte(usart_cfg_st *usart, BYTE *pc_byte)
+ * \brief take next byte to transmit from tx ring, to be called from architecture tx interrupt handler
+ * \param pc_byte location for byte to be transmitted
+ * \return true if byte was taken, false if tx ring is empty (TXE interrupt should be disabled)
+ */
+static inline BOOL usartIsrTxByte(usart_cfg_st *usart, BYTE *pc_byte)
+{
+	return (ringGet(&usart->usart_tx_ring, pc_byte));
+}
+
 #ifdef __cplusplus
 }
 #endif // extern "C"
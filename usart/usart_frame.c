@@ -0,0 +1,272 @@
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+/*!
+ * \file usart_frame.c
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief COBS/SLIP packet framing on top of buffered usart - implementation.
+ * \note
+ * For detailed description see header file.
+ */
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#include "ehal/usart/usart_frame.h"
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+// longest run of non-zero bytes in single COBS block
+#define USART_FRAME_COBS_RUN_MAX 254
+
+// static functions
+static VOID usart_frame_append(usart_frame_dec_st *dec, const BYTE c_byte);
+static e_usartframe_t usart_frame_decodeCobs(usart_frame_dec_st *dec, const BYTE c_byte);
+static e_usartframe_t usart_frame_decodeSlip(usart_frame_dec_st *dec, BYTE c_byte);
+static VOID usart_frame_send(usart_cfg_st *usart, const BYTE *pc_data, UINT16 ui16_length);
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+// --------------------------------------------------------------------------
+VOID usartFrameCobsSend(usart_cfg_st *usart, const BYTE *pc_data, const UINT16 ui16_length)
+{
+	UINT16 ui16_pos = 0;
+	UINT8 ui8_run;
+
+	for (;;)
+	{
+		// find block of non-zero bytes, its length gives the code
+		for (ui8_run = 0; (ui16_pos + ui8_run < ui16_length) && (ui8_run < USART_FRAME_COBS_RUN_MAX)
+			&& pc_data[ui16_pos + ui8_run]; ++ui8_run);
+
+		usartSendByte(usart, ui8_run + 1);
+		usart_frame_send(usart, pc_data + ui16_pos, ui8_run);
+		ui16_pos += ui8_run;
+
+		if (ui16_pos == ui16_length)
+			break;
+
+		// skip zero encoded by the code, full block is not followed by zero
+		if (ui8_run < USART_FRAME_COBS_RUN_MAX)
+			++ui16_pos;
+	}
+
+	usartSendByte(usart, USART_FRAME_COBS_DELIMITER);
+}
+
+// --------------------------------------------------------------------------
+VOID usartFrameSlipSend(usart_cfg_st *usart, const BYTE *pc_data, const UINT16 ui16_length)
+{
+	UINT16 ui16_start = 0;
+
+	// leading delimiter flushes line noise collected by receiver
+	usartSendByte(usart, USART_FRAME_SLIP_END);
+
+	for (UINT16 i = 0; i < ui16_length; ++i)
+	{
+		if ((USART_FRAME_SLIP_END != pc_data[i]) && (USART_FRAME_SLIP_ESC != pc_data[i]))
+			continue;
+
+		// queue plain span at once, escape special byte
+		usart_frame_send(usart, pc_data + ui16_start, i - ui16_start);
+		usartSendByte(usart, USART_FRAME_SLIP_ESC);
+		usartSendByte(usart, (USART_FRAME_SLIP_END == pc_data[i])?(USART_FRAME_SLIP_ESC_END):(USART_FRAME_SLIP_ESC_ESC));
+		ui16_start = i + 1;
+	}
+
+	usart_frame_send(usart, pc_data + ui16_start, ui16_length - ui16_start);
+	usartSendByte(usart, USART_FRAME_SLIP_END);
+}
+
+// --------------------------------------------------------------------------
+VOID usartFrameDecoderInit(usart_frame_dec_st *dec, const e_usartframe_type_t type, BYTE *pc_buff, const UINT16 ui16_size)
+{
+	dec->type = type;
+
+	dec->pc_buff = pc_buff;
+	dec->ui16_size = ui16_size;
+	dec->ui16_length = 0;
+
+	dec->ui8_code = 0;
+	dec->ui8_left = 0;
+	dec->b_escape = false;
+	dec->b_error = false;
+}
+
+// --------------------------------------------------------------------------
+e_usartframe_t usartFrameDecodeByte(usart_frame_dec_st *dec, const BYTE c_byte)
+{
+	if (USART_FRAME_SLIP == dec->type)
+		return (usart_frame_decodeSlip(dec, c_byte));
+
+	return (usart_frame_decodeCobs(dec, c_byte));
+}
+
+// --------------------------------------------------------------------------
+e_usartframe_t usartFrameReceive(usart_cfg_st *usart, usart_frame_dec_st *dec)
+{
+	const BYTE *pc_data;
+	usart_bufsize_t length;
+
+	for (;;)
+	{
+		// decode in place, contiguous region at a time
+		usartRxPeek(usart, &pc_data, &length);
+		if (!length)
+			return (USART_FRAME_PENDING);
+
+		for (usart_bufsize_t i = 0; i < length; ++i)
+		{
+			if (USART_FRAME_READY == usartFrameDecodeByte(dec, pc_data[i]))
+			{
+				usartRxConsume(usart, i + 1);
+				return (USART_FRAME_READY);
+			}
+		}
+
+		usartRxConsume(usart, length);
+	}
+}
+
+// static functions
+// --------------------------------------------------------------------------
+static VOID usart_frame_append(usart_frame_dec_st *dec, const BYTE c_byte)
+{
+	if (dec->ui16_length >= dec->ui16_size)
+	{
+		dec->b_error = true;
+		return;
+	}
+
+	dec->pc_buff[dec->ui16_length++] = c_byte;
+}
+
+// --------------------------------------------------------------------------
+static e_usartframe_t usart_frame_decodeCobs(usart_frame_dec_st *dec, const BYTE c_byte)
+{
+	e_usartframe_t result;
+
+	if (USART_FRAME_COBS_DELIMITER == c_byte)
+	{
+		// ignore empty frames (e.g. delimiters used for resynchronization)
+		if (!dec->ui8_code)
+			return (USART_FRAME_PENDING);
+
+		result = (dec->b_error || dec->ui8_left)?(USART_FRAME_ERROR):(USART_FRAME_READY);
+		dec->ui8_code = 0;
+		dec->ui8_left = 0;
+
+		return (result);
+	}
+
+	// first code byte starts new frame
+	if (!dec->ui8_code)
+	{
+		dec->ui16_length = 0;
+		dec->b_error = false;
+	}
+	else if (dec->b_error)
+		return (USART_FRAME_PENDING);
+
+	if (dec->ui8_left)
+	{
+		usart_frame_append(dec, c_byte);
+		--dec->ui8_left;
+		return (USART_FRAME_PENDING);
+	}
+
+	// next code byte, block shorter than maximum was followed by zero
+	if (dec->ui8_code && (dec->ui8_code != (USART_FRAME_COBS_RUN_MAX + 1)))
+		usart_frame_append(dec, 0x00);
+
+	dec->ui8_code = c_byte;
+	dec->ui8_left = c_byte - 1;
+
+	return (USART_FRAME_PENDING);
+}
+
+// --------------------------------------------------------------------------
+static e_usartframe_t usart_frame_decodeSlip(usart_frame_dec_st *dec, BYTE c_byte)
+{
+	e_usartframe_t result;
+
+	if (USART_FRAME_SLIP_END == c_byte)
+	{
+		// ignore empty frames (e.g. leading delimiters)
+		if (!dec->ui8_code)
+			return (USART_FRAME_PENDING);
+
+		result = (dec->b_error || dec->b_escape)?(USART_FRAME_ERROR):(USART_FRAME_READY);
+		dec->ui8_code = 0;
+		dec->b_escape = false;
+
+		return (result);
+	}
+
+	// first byte starts new frame, ui8_code marks frame in progress
+	if (!dec->ui8_code)
+	{
+		dec->ui8_code = 1;
+		dec->ui16_length = 0;
+		dec->b_error = false;
+	}
+	else if (dec->b_error)
+		return (USART_FRAME_PENDING);
+
+	if (dec->b_escape)
+	{
+		dec->b_escape = false;
+		if (USART_FRAME_SLIP_ESC_END == c_byte)
+			c_byte = USART_FRAME_SLIP_END;
+		else if (USART_FRAME_SLIP_ESC_ESC == c_byte)
+			c_byte = USART_FRAME_SLIP_ESC;
+		else
+		{
+			dec->b_error = true;
+			return (USART_FRAME_PENDING);
+		}
+	}
+	else if (USART_FRAME_SLIP_ESC == c_byte)
+	{
+		dec->b_escape = true;
+		return (USART_FRAME_PENDING);
+	}
+
+	usart_frame_append(dec, c_byte);
+
+	return (USART_FRAME_PENDING);
+}
+
+// --------------------------------------------------------------------------
+static VOID usart_frame_send(usart_cfg_st *usart, const BYTE *pc_data, UINT16 ui16_length)
+{
+	UINT16 ui16_chunk;
+
+	// usartSend treats 0 as maximum length and limits block size
+	while (ui16_length)
+	{
+		ui16_chunk = (ui16_length > USART_SEND_MAX_LENGTH)?(USART_SEND_MAX_LENGTH):(ui16_length);
+		usartSend(usart, pc_data, ui16_chunk);
+		pc_data += ui16_chunk;
+		ui16_length -= ui16_chunk;
+	}
+}
+
+// END
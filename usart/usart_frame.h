@@ -0,0 +1,154 @@
+/*!
+ * \file usart_frame.h
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief COBS/SLIP packet framing on top of buffered usart - definitions
+ * \details
+ * Encoders stream frames directly into usart tx ring, without intermediate buffer. COBS encoder looks ahead
+ * in source data for the next zero byte, so each block code is known before its data is queued.
+ *
+ * Decoder works byte by byte with constant cost per byte and writes decoded payload to buffer given by user.
+ * Corrupted or too long frames are dropped and decoder resynchronizes on next frame delimiter.
+ */
+
+#ifndef _USART_FRAME_H
+#define _USART_FRAME_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#include "ehal/global.h"
+#include "ehal/usart/usart.h"
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+/*!
+ * \def USART_FRAME_COBS_DELIMITER
+ * \brief COBS frame delimiter
+ */
+#define USART_FRAME_COBS_DELIMITER 0x00
+
+/*!
+ * \def USART_FRAME_SLIP_END
+ * \brief SLIP frame delimiter and escape codes
+ */
+#define USART_FRAME_SLIP_END 0xC0
+#define USART_FRAME_SLIP_ESC 0xDB
+#define USART_FRAME_SLIP_ESC_END 0xDC
+#define USART_FRAME_SLIP_ESC_ESC 0xDD
+
+/*!
+ * \enum e_usartframe_type
+ * \brief framing methods
+ */
+enum e_usartframe_type
+{
+	USART_FRAME_COBS = 0,
+	USART_FRAME_SLIP
+};
+/*!
+ * \typedef e_usartframe_type_t
+ * \brief framing methods
+ */
+typedef enum e_usartframe_type e_usartframe_type_t;
+
+/*!
+ * \enum e_usartframe
+ * \brief decoder status
+ */
+enum e_usartframe
+{
+	USART_FRAME_PENDING = 0,
+	USART_FRAME_READY,
+	USART_FRAME_ERROR
+};
+/*!
+ * \typedef e_usartframe_t
+ * \brief decoder status
+ */
+typedef enum e_usartframe e_usartframe_t;
+
+/*!
+ * \struct usart_frame_dec_st
+ * \brief streaming decoder state
+ */
+typedef struct
+{
+	e_usartframe_type_t type;
+
+	BYTE *pc_buff;
+	UINT16 ui16_size;
+	UINT16 ui16_length;
+
+	UINT8 ui8_code;
+	UINT8 ui8_left;
+	BOOL b_escape;
+	BOOL b_error;
+} usart_frame_dec_st;
+
+
+/***************************************************************************
+ *	FUNCTIONS
+ ***************************************************************************/
+
+/*!
+ * \fn usartFrameCobsSend(usart_cfg_st *usart, const BYTE *pc_data, const UINT16 ui16_length)
+ * \brief encode data with COBS and queue it with trailing delimiter in tx ring
+ * \param pc_data payload
+ * \param ui16_length payload length
+ */
+VOID usartFrameCobsSend(usart_cfg_st *usart, const BYTE *pc_data, const UINT16 ui16_length);
+/*!
+ * \fn usartFrameSlipSend(usart_cfg_st *usart, const BYTE *pc_data, const UINT16 ui16_length)
+ * \brief encode data with SLIP and queue it surrounded with delimiters in tx ring
+ * \param pc_data payload
+ * \param ui16_length payload length
+ */
+VOID usartFrameSlipSend(usart_cfg_st *usart, const BYTE *pc_data, const UINT16 ui16_length);
+
+/*!
+ * \fn usartFrameDecoderInit(usart_frame_dec_st *dec, const e_usartframe_type_t type, BYTE *pc_buff, const UINT16 ui16_size)
+ * \brief prepare streaming decoder
+ * \param dec decoder state
+ * \param type framing method
+ * \param pc_buff buffer for decoded payload
+ * \param ui16_size buffer size, longer frames are dropped
+ */
+VOID usartFrameDecoderInit(usart_frame_dec_st *dec, const e_usartframe_type_t type, BYTE *pc_buff, const UINT16 ui16_size);
+/*!
+ * \fn usartFrameDecodeByte(usart_frame_dec_st *dec, const BYTE c_byte)
+ * \brief feed single received byte to decoder
+ * \param dec decoder state
+ * \param c_byte received byte
+ * \return USART_FRAME_READY when payload of dec->ui16_length bytes is complete in buffer, USART_FRAME_ERROR when
+ * corrupted frame was dropped, USART_FRAME_PENDING otherwise
+ * \note Payload is valid until next byte is fed.
+ */
+e_usartframe_t usartFrameDecodeByte(usart_frame_dec_st *dec, const BYTE c_byte);
+/*!
+ * \fn usartFrameReceive(usart_cfg_st *usart, usart_frame_dec_st *dec)
+ * \brief feed bytes waiting in rx ring to decoder, stops after complete frame
+ * \param dec decoder state
+ * \return USART_FRAME_READY when frame is complete, USART_FRAME_PENDING otherwise
+ * \note Bytes following completed frame stay in rx ring.
+ */
+e_usartframe_t usartFrameReceive(usart_cfg_st *usart, usart_frame_dec_st *dec);
+
+#ifdef __cplusplus
+}
+#endif // extern "C"
+
+#endif // _USART_FRAME_H
+
+// END
@@ -0,0 +1,72 @@
+/*!
+ * \file usart_stats.h
+ *
+ * \author Marcin O'BenY Benka <obeny@obeny.net>
+ * \date 17.10.2026
+ * \version 1
+ *
+ * \brief per port usart statistics - definitions
+ * \details
+ * Cumulative counters collected when USART_STATS is defined in config.h. Structure is a part of usart_cfg_st,
+ * so this header has to be included by usart_march.h. Counters are read with usartStatsGet().
+ */
+
+#ifndef _USART_STATS_H
+#define _USART_STATS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************
+ *	INCLUDES
+ ***************************************************************************/
+
+#include "ehal/global.h"
+
+
+/***************************************************************************
+ *	DEFINITIONS
+ ***************************************************************************/
+
+/*!
+ * \enum e_usarterror
+ * \brief receive errors reported by architecture interrupt handler
+ */
+enum e_usarterror
+{
+	USART_ERROR_FRAMING = 0,
+	USART_ERROR_PARITY,
+	USART_ERROR_OVERRUN
+};
+/*!
+ * \typedef e_usarterror_t
+ * \brief receive errors reported by architecture interrupt handler
+ */
+typedef enum e_usarterror e_usarterror_t;
+
+/*!
+ * \struct usart_stats_st
+ * \brief usart port statistics
+ */
+typedef struct
+{
+	UINT32 ui32_rx_bytes;			// bytes stored in rx ring
+	UINT32 ui32_tx_bytes;			// bytes queued in tx ring
+	UINT32 ui32_rx_dropped;			// bytes dropped due to full rx ring
+	UINT16 ui16_rx_overflows;		// rx ring overflow events (one for each series of dropped bytes)
+	UINT16 ui16_rx_high_water;		// max rx ring usage
+	UINT16 ui16_tx_high_water;		// max tx ring usage
+	UINT16 ui16_framing_errors;		// frames with missing stop bit
+	UINT16 ui16_parity_errors;		// frames with wrong parity
+	UINT16 ui16_hw_overruns;		// bytes lost by hardware before interrupt was served
+	UINT32 ui32_tx_wait_max;		// longest wait for free tx ring space in jiffies (requires SYNC_TIMER_JIFFIES)
+} usart_stats_st;
+
+#ifdef __cplusplus
+}
+#endif // extern "C"
+
+#endif // _USART_STATS_H
+
+// END